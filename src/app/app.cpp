@@ -14,6 +14,7 @@
 #include "automata/ta.pb.h"
 #include "automata/ta_product.h"
 #include "automata/ta_proto.h"
+#include "automata/ta_region_graph.h"
 #include "automata/ta_regions.h"
 #include "mtl/MTLFormula.h"
 #include "mtl/mtl.pb.h"
@@ -21,6 +22,9 @@
 #include "mtl_ata_translation/translator.h"
 #include "search/create_controller.h"
 #include "search/heuristics.h"
+#include "search/portfolio.h"
+#include "search/search_budget.h"
+#include "search/search_progress.h"
 #include "search/search.h"
 #include "search/search_tree.h"
 #include "search/ta_adapter.h"
@@ -35,6 +39,7 @@
 #include <spdlog/spdlog.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <boost/program_options.hpp>
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
@@ -49,13 +54,15 @@
 namespace tacos::app {
 
 namespace {
-std::unique_ptr<search::Heuristic<
-  long,
-  search::SearchTreeNode<automata::ta::Location<std::vector<std::string>>, std::string>>>
-create_heuristic(const std::string &name, const std::set<std::string> environment_actions = {})
+using PlantLocation = automata::ta::Location<std::vector<std::string>>;
+
+std::unique_ptr<search::Heuristic<long, search::SearchTreeNode<PlantLocation, std::string>>>
+create_heuristic(const std::string                                           &name,
+                 const std::set<std::string>                                  environment_actions,
+                 const std::map<PlantLocation, std::size_t>                  &plant_distances,
+                 const std::map<logic::MTLFormula<std::string>, std::size_t> &ata_distances)
 {
-	using NodeT =
-	  search::SearchTreeNode<automata::ta::Location<std::vector<std::string>>, std::string>;
+	using NodeT = search::SearchTreeNode<PlantLocation, std::string>;
 	if (name == "time") {
 		return std::make_unique<search::TimeHeuristic<long, NodeT>>();
 	} else if (name == "bfs") {
@@ -64,6 +71,12 @@ create_heuristic(const std::string &name, const std::set<std::string> environmen
 		return std::make_unique<search::DfsHeuristic<long, NodeT>>();
 	} else if (name == "random") {
 		return std::make_unique<search::RandomHeuristic<long, NodeT>>();
+	} else if (name == "distance") {
+		return std::make_unique<search::AcceptanceDistanceHeuristic<long,
+		                                                            NodeT,
+		                                                            PlantLocation,
+		                                                            logic::MTLFormula<std::string>>>(
+		  plant_distances, ata_distances);
 	} else if (name == "composite") {
 		const long weight_canonical_words     = 16;
 		const long weight_environment_actions = 4;
@@ -116,7 +129,29 @@ Launcher::parse_command_line(int argc, const char *const argv[])
     ("hide-controller-labels", bool_switch()->default_value(false),
      "Generate a compact controller dot graph without node labels")
     ("output,o", value(&controller_proto_path), "Save the resulting controller as pbtxt")
-    ("heuristic", value(&heuristic)->default_value("composite"), "The heuristic to use (one of 'composite', 'time', 'bfs', 'dfs', 'random')")
+    ("heuristic", value(&heuristic)->default_value("composite"), "The heuristic to use (one of 'composite', 'time', 'bfs', 'dfs', 'random', 'distance')")
+    ("numa", bool_switch()->default_value(false),
+     "Pin the search threads to NUMA nodes and prefer expanding nodes on the NUMA node that created them")
+    ("portfolio", value(&portfolio)->multitoken(),
+     "Run one search per given heuristic concurrently and use the result of the first one to finish")
+    ("reachable-plant", bool_switch()->default_value(false),
+     "Only construct the part of the plant product that is reachable from its initial location")
+    ("backward-pruning", bool_switch()->default_value(false),
+     "Do not expand nodes that cannot reach a bad configuration according to a backward analysis")
+    ("plant-region-graph", bool_switch()->default_value(false),
+     "Precompute the region graph of the plant and use it to compute the plant's successors")
+    ("plant-successor-cache", value(&successor_cache_size)->default_value(0),
+     "Cache the plant's enabled transitions for up to N regionalized configurations (0 to disable)")
+    ("progress-interval", value(&progress_interval)->default_value(0),
+     "Report the search progress every N seconds (0 to disable)")
+    ("progress-file", value(&progress_path),
+     "Write the search progress as JSON lines to the given file instead of the log")
+    ("time-budget", value(&time_budget)->default_value(0),
+     "Stop the search after N seconds (0 for no limit)")
+    ("node-budget", value(&node_budget)->default_value(0),
+     "Stop the search after N search nodes (0 for no limit)")
+    ("memory-budget", value(&memory_budget)->default_value(0),
+     "Stop the search if the search graph is estimated to use more than N MiB (0 for no limit)")
     ;
 	// clang-format on
 
@@ -133,6 +168,10 @@ Launcher::parse_command_line(int argc, const char *const argv[])
 	debug                  = variables["debug"].as<bool>();
 	multi_threaded         = !variables["single-threaded"].as<bool>();
 	hide_controller_labels = variables["hide-controller-labels"].as<bool>();
+	reachable_plant        = variables["reachable-plant"].as<bool>();
+	use_region_graph       = variables["plant-region-graph"].as<bool>();
+	backward_pruning       = variables["backward-pruning"].as<bool>();
+	numa                   = variables["numa"].as<bool>();
 	if (verbose) {
 		spdlog::set_level(spdlog::level::debug);
 	}
@@ -168,7 +207,9 @@ Launcher::run()
 	automata::ta::proto::ProductAutomaton ta_proto;
 	SPDLOG_INFO("Reading plant TA from '{}'", plant_path.c_str());
 	read_proto_from_file(plant_path, &ta_proto);
-	auto plant = automata::ta::parse_product_proto(ta_proto);
+	auto plant = automata::ta::parse_product_proto(ta_proto, reachable_plant);
+	statistics                 = RunStatistics{};
+	statistics.plant_locations = plant.get_locations().size();
 	SPDLOG_INFO("TA:\n{}", plant);
 	if (!plant_dot_graph.empty()) {
 		visualization::ta_to_graphviz(plant).render_to_file(plant_dot_graph);
@@ -195,19 +236,111 @@ Launcher::run()
 	SPDLOG_INFO("Controller actions: {}", fmt::join(controller_actions, ", "));
 	SPDLOG_INFO("Environment actions: {}", fmt::join(environment_actions, ", "));
 	SPDLOG_INFO("Initializing search");
-	const auto         K = std::max(plant.get_largest_constant(), spec.get_largest_constant());
-	search::TreeSearch search(&plant,
-	                          &ata,
-	                          controller_actions,
-	                          environment_actions,
-	                          K,
-	                          true,
-	                          true,
-	                          create_heuristic(heuristic, environment_actions));
-	SPDLOG_INFO("Running search {}", multi_threaded ? "multi-threaded" : "single-threaded");
-	search.build_tree(multi_threaded);
+	const auto K = std::max(plant.get_largest_constant(), spec.get_largest_constant());
+	// Regionalize each plant clock and ATA location only up to its own maximal constant.
+	const search::MaxConstants<std::string> max_constants{K,
+	                                                      plant.get_largest_constants(),
+	                                                      ata.get_largest_constants()};
+	using TreeSearch = search::TreeSearch<PlantLocation, std::string>;
+	// Without a portfolio, run a single search with the selected heuristic.
+	const std::vector<std::string> heuristics =
+	  portfolio.empty() ? std::vector<std::string>{heuristic} : portfolio;
+	// Split the available threads between all searches of the portfolio.
+	const std::size_t num_threads =
+	  multi_threaded ? std::max(std::size_t{1}, std::thread::hardware_concurrency() / heuristics.size())
+	                 : 1;
+	const auto affinity = numa ? utilities::ThreadPool<long>::Affinity::NUMA
+	                           : utilities::ThreadPool<long>::Affinity::NONE;
+	// The backward analysis is only needed by the distance heuristic and by backward pruning.
+	std::map<PlantLocation, std::size_t>                  plant_distances;
+	std::map<logic::MTLFormula<std::string>, std::size_t> ata_distances;
+	if (backward_pruning
+	    || std::find(std::begin(heuristics), std::end(heuristics), "distance")
+	         != std::end(heuristics)) {
+		plant_distances = plant.get_acceptance_distances();
+		ata_distances   = ata.get_acceptance_distances();
+	}
+	std::vector<std::unique_ptr<TreeSearch>> searches;
+	for (const auto &name : heuristics) {
+		searches.push_back(std::make_unique<TreeSearch>(
+		  &plant,
+		  &ata,
+		  controller_actions,
+		  environment_actions,
+		  max_constants,
+		  true,
+		  true,
+		  create_heuristic(name, environment_actions, plant_distances, ata_distances),
+		  num_threads,
+		  affinity));
+		if (backward_pruning) {
+			searches.back()->enable_backward_pruning(plant_distances, ata_distances);
+		}
+	}
+	using RegionGraph = automata::ta::RegionGraph<std::vector<std::string>, std::string>;
+	std::unique_ptr<RegionGraph> region_graph;
+	if (use_region_graph) {
+		SPDLOG_INFO("Computing the region graph of the plant");
+		region_graph = std::make_unique<RegionGraph>(plant,
+		                                             static_cast<RegionIndex>(K),
+		                                             multi_threaded ? std::thread::hardware_concurrency()
+		                                                            : 1);
+		SPDLOG_INFO("Region graph has {} configurations", region_graph->size());
+		statistics.region_graph_configurations = region_graph->size();
+		for (auto &search : searches) {
+			search->get_successor_generator().set_region_graph(region_graph.get());
+		}
+	} else if (successor_cache_size > 0) {
+		for (auto &search : searches) {
+			search->get_successor_generator().enable_successor_cache(successor_cache_size);
+		}
+	}
+	if (progress_interval > 0) {
+		search::ProgressCallback callback = search::log_progress;
+		if (!progress_path.empty()) {
+			callback = search::JsonProgressWriter{progress_path};
+		}
+		for (auto &search : searches) {
+			search->set_progress_reporter(callback, std::chrono::seconds{progress_interval});
+		}
+	}
+	search::SearchBudget budget;
+	if (time_budget > 0) {
+		budget.time = std::chrono::seconds{time_budget};
+	}
+	if (node_budget > 0) {
+		budget.nodes = node_budget;
+	}
+	if (memory_budget > 0) {
+		budget.memory = memory_budget * 1024 * 1024;
+	}
+	std::vector<TreeSearch *> portfolio_searches;
+	for (auto &search : searches) {
+		search->set_budget(budget);
+		portfolio_searches.push_back(search.get());
+	}
+	std::size_t winner = 0;
+	if (searches.size() == 1) {
+		SPDLOG_INFO("Running search {}", multi_threaded ? "multi-threaded" : "single-threaded");
+		searches.front()->build_tree(multi_threaded);
+	} else {
+		SPDLOG_INFO("Running {} portfolio search with heuristics {} and {} threads each",
+		            multi_threaded ? "multi-threaded" : "single-threaded",
+		            fmt::join(heuristics, ", "),
+		            num_threads);
+		if (const auto first = search::run_portfolio(portfolio_searches, multi_threaded); first) {
+			winner = *first;
+			SPDLOG_INFO("Heuristic '{}' finished first", heuristics[winner]);
+		}
+	}
+	auto &search = *searches[winner];
 	search.label();
 	SPDLOG_INFO("Search complete!");
+	statistics.search          = search.get_statistics();
+	statistics.search_nodes    = search.get_size();
+	statistics.budget_exceeded = search.is_budget_exceeded();
+	statistics.root_label      = search.get_root()->label;
+	SPDLOG_INFO("Search statistics:\n{}", statistics.search);
 	if (debug) {
 		if (tree_dot_graph.empty()) {
 			SPDLOG_ERROR("Debugging enabled but no output file given, please specify the path to the "
@@ -221,11 +354,15 @@ Launcher::run()
 		SPDLOG_INFO("Writing search tree to '{}'", tree_dot_graph.c_str());
 		visualization::search_tree_to_graphviz(*search.get_root(), true).render_to_file(tree_dot_graph);
 	}
+	if (search.is_budget_exceeded() && search.get_root()->label != search::NodeLabel::TOP) {
+		SPDLOG_WARN("Search budget exceeded before a controller was found, the result is unknown");
+		return;
+	}
 	SPDLOG_INFO("Creating controller");
 	auto controller = controller_synthesis::create_controller(search.get_root(),
 	                                                          controller_actions,
 	                                                          environment_actions,
-	                                                          K);
+	                                                          max_constants);
 	if (!controller_dot_path.empty()) {
 		SPDLOG_INFO("Writing controller to '{}'", controller_dot_path.c_str());
 		visualization::ta_to_graphviz(controller, !hide_controller_labels)
@@ -238,4 +375,10 @@ Launcher::run()
 	}
 }
 
+const RunStatistics &
+Launcher::get_statistics() const
+{
+	return statistics;
+}
+
 } // namespace tacos::app
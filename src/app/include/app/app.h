@@ -7,12 +7,33 @@
  ****************************************************************************/
 
 
+#include "search/search_statistics.h"
+#include "search/search_tree.h"
+
 #include <google/protobuf/message.h>
 
 #include <filesystem>
+#include <vector>
 
 namespace tacos::app {
 
+/** @brief Information about the last run of the launcher. */
+struct RunStatistics
+{
+	/** The number of locations of the plant. */
+	std::size_t plant_locations{0};
+	/** The number of configurations of the plant's region graph, zero if it was not computed. */
+	std::size_t region_graph_configurations{0};
+	/** The number of nodes of the search graph. */
+	std::size_t search_nodes{0};
+	/** Whether the search was stopped because the budget was exceeded. */
+	bool budget_exceeded{false};
+	/** The label of the root node after the search. */
+	search::NodeLabel root_label{search::NodeLabel::UNLABELED};
+	/** The statistics of the search that determined the result. */
+	search::SearchStatistics search;
+};
+
 /** @brief Launcher for the main application.
  * The launcher runs the main application, reads the input from pbtxt files, runs the search, and
  * finally generates a controller.*/
@@ -28,21 +49,38 @@ public:
 	/** Run the launcher. */
 	void run();
 
+	/** Get information about the last run.
+	 * @return The statistics of the last call to run()
+	 */
+	const RunStatistics &get_statistics() const;
+
 private:
 	void parse_command_line(int argc, const char *const argv[]);
 
-	std::filesystem::path plant_path;
-	std::filesystem::path specification_path;
-	std::filesystem::path controller_dot_path;
-	std::filesystem::path controller_proto_path;
-	std::filesystem::path plant_dot_graph;
-	std::filesystem::path tree_dot_graph;
-	bool                  show_help{false};
-	bool                  multi_threaded{true};
-	bool                  debug{false};
-	bool                  hide_controller_labels{false};
-	std::set<std::string> controller_actions;
-	std::string           heuristic;
+	std::filesystem::path    plant_path;
+	std::filesystem::path    specification_path;
+	std::filesystem::path    controller_dot_path;
+	std::filesystem::path    controller_proto_path;
+	std::filesystem::path    plant_dot_graph;
+	std::filesystem::path    tree_dot_graph;
+	std::filesystem::path    progress_path;
+	bool                     show_help{false};
+	bool                     multi_threaded{true};
+	bool                     debug{false};
+	bool                     hide_controller_labels{false};
+	bool                     reachable_plant{false};
+	bool                     use_region_graph{false};
+	bool                     backward_pruning{false};
+	bool                     numa{false};
+	std::set<std::string>    controller_actions;
+	std::string              heuristic;
+	std::vector<std::string> portfolio;
+	unsigned int             progress_interval{0};
+	unsigned int             time_budget{0};
+	std::size_t              node_budget{0};
+	std::size_t              memory_budget{0};
+	std::size_t              successor_cache_size{0};
+	RunStatistics            statistics;
 };
 
 void read_proto_from_file(const std::filesystem::path &path, google::protobuf::Message *output);
@@ -176,10 +176,20 @@ public:
 		return alphabet_;
 	}
 
+	/** Get the locations of the automaton.
+	 * These are the initial location, the final locations, the sink location, and the source
+	 * locations of all transitions. A location that only occurs in the formula of a transition and
+	 * has no outgoing transitions of its own is not included.
+	 * @return The locations of the automaton
+	 */
+	[[nodiscard]] std::set<LocationT> get_locations() const;
+
 	/** Compute the resulting configurations after making a symbol step.
+	 * Only minimal configurations are returned, i.e., a configuration that is a superset of another
+	 * resulting configuration is omitted.
 	 * @param start_states The starting configuration
 	 * @param symbol The symbol to read
-	 * @return The configurations after making the symbol step
+	 * @return The minimal configurations after making the symbol step
 	 */
 	std::set<Configuration<LocationT>> make_symbol_step(const Configuration<LocationT> &start_states,
 	                                                    const SymbolT &                 symbol) const;
@@ -216,6 +226,32 @@ public:
 	[[nodiscard]] bool
 	is_accepting_configuration(const Configuration<LocationT> &configuration) const;
 
+	/** Check if the given location is accepting.
+	 * A configuration is accepting if and only if all its locations are accepting.
+	 * @param location The location to check
+	 * @return true if the location is a final location of the ATA
+	 */
+	[[nodiscard]] bool
+	is_accepting_location(const LocationT &location) const;
+
+	/** @brief Compute the distance of each location to an accepting configuration.
+	 * The distance of a location is the minimal number of symbol steps that lead from the
+	 * configuration that only contains the location to an accepting configuration. Clock constraints
+	 * are ignored, so the distance is a lower bound.
+	 * @return A map from each location to its distance, locations that cannot reach an accepting
+	 * configuration are omitted
+	 */
+	[[nodiscard]] std::map<LocationT, std::size_t> get_acceptance_distances() const;
+
+	/** @brief Compute the largest constant that the clock of each location is compared to.
+	 * The constant of a location bounds all clock constraints of its transitions, as well as the
+	 * constants of all locations that its transitions lead to without resetting the clock, as these
+	 * locations inherit the clock valuation. Clock valuations above the constant of a location are
+	 * therefore indistinguishable in that location.
+	 * @return A map from each location with outgoing transitions to its largest constant
+	 */
+	[[nodiscard]] std::map<LocationT, Endpoint> get_largest_constants() const;
+
 	/** Check if the ATA accepts a timed word.
 	 * @param word The timed word to check
 	 * @return true if the given word is accepted
@@ -10,8 +10,46 @@
 
 #include "ata.h"
 
+#include <experimental/set>
+
 namespace tacos::automata::ata {
 
+namespace details {
+
+/** Insert a configuration into a set of minimal configurations.
+ * The configuration is only inserted if it is not a superset of any configuration in the set. All
+ * configurations in the set that are supersets of the new configuration are removed.
+ * @param configurations The set of minimal configurations to insert into
+ * @param configuration The configuration to insert
+ */
+template <typename LocationT>
+void
+insert_minimal_configuration(std::set<Configuration<LocationT>> &configurations,
+                             Configuration<LocationT>          &&configuration)
+{
+	if (std::any_of(std::begin(configurations),
+	                std::end(configurations),
+	                [&configuration](const auto &other) {
+		                // True if the new configuration is a superset of the other configuration.
+		                return std::includes(std::begin(configuration),
+		                                     std::end(configuration),
+		                                     std::begin(other),
+		                                     std::end(other));
+	                })) {
+		return;
+	}
+	std::experimental::erase_if(configurations, [&configuration](const auto &other) {
+		// True if the other configuration is a superset of the new configuration.
+		return std::includes(std::begin(other),
+		                     std::end(other),
+		                     std::begin(configuration),
+		                     std::end(configuration));
+	});
+	configurations.insert(std::move(configuration));
+}
+
+} // namespace details
+
 template <typename LocationT, typename SymbolT>
 std::ostream &
 operator<<(std::ostream &os, const tacos::automata::ata::Transition<LocationT, SymbolT> &transition)
@@ -199,19 +237,23 @@ AlternatingTimedAutomaton<LocationT, SymbolT>::make_symbol_step(
 	//
 	// Populate the configurations by splitting the first configuration in all minimal models
 	// { { m1, m2, m3 } } -> { { m1 }, { m2 }, { m3 } }
-	ranges::for_each(models[0],
-	                 [&](const auto &state_model) { configurations.insert({state_model}); });
-	// Add models from the other configurations
+	ranges::for_each(models[0], [&](const auto &state_model) {
+		details::insert_minimal_configuration(configurations, Configuration<LocationT>{state_model});
+	});
+	// Add models from the other configurations. Only keep minimal configurations: if some partial
+	// configuration is a superset of another one, then each of its expansions is also a superset of
+	// the corresponding expansion of the other configuration, so we can prune it right away.
 	std::for_each(std::next(models.begin()), models.end(), [&](const auto &state_models) {
 		std::set<Configuration<LocationT>> expanded_configurations;
 		ranges::for_each(state_models, [&](const auto &state_model) {
 			ranges::for_each(configurations, [&](const auto &configuration) {
 				auto expanded_configuration = configuration;
 				expanded_configuration.insert(state_model.begin(), state_model.end());
-				expanded_configurations.insert(expanded_configuration);
+				details::insert_minimal_configuration(expanded_configurations,
+				                                      std::move(expanded_configuration));
 			});
 		});
-		configurations = expanded_configurations;
+		configurations = std::move(expanded_configurations);
 	});
 	// If we get here and the configurations are empty, something went wrong. If there is a transition
 	// without model, this should have been caught earlier.
@@ -295,10 +337,87 @@ AlternatingTimedAutomaton<LocationT, SymbolT>::is_accepting_configuration(
   const Configuration<LocationT> &configuration) const
 {
 	return std::all_of(configuration.begin(), configuration.end(), [this](auto const &state) {
-		return final_locations_.count(state.location) > 0;
+		return is_accepting_location(state.location);
 	});
 }
 
+template <typename LocationT, typename SymbolT>
+std::set<LocationT>
+AlternatingTimedAutomaton<LocationT, SymbolT>::get_locations() const
+{
+	std::set<LocationT> locations = final_locations_;
+	locations.insert(initial_location_);
+	if (sink_location_) {
+		locations.insert(*sink_location_);
+	}
+	for (const auto &transition : transitions_) {
+		locations.insert(transition.source_);
+	}
+	return locations;
+}
+
+template <typename LocationT, typename SymbolT>
+[[nodiscard]] bool
+AlternatingTimedAutomaton<LocationT, SymbolT>::is_accepting_location(
+  const LocationT &location) const
+{
+	return final_locations_.count(location) > 0;
+}
+
+template <typename LocationT, typename SymbolT>
+std::map<LocationT, std::size_t>
+AlternatingTimedAutomaton<LocationT, SymbolT>::get_acceptance_distances() const
+{
+	std::map<LocationT, std::size_t> distances;
+	for (const auto &location : final_locations_) {
+		distances[location] = 0;
+	}
+	// Iterate until a fixed point is reached. Each iteration can only decrease distances and a
+	// distance is bounded by the number of locations, so this terminates.
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (const auto &transition : transitions_) {
+			const auto distance = transition.formula_->get_acceptance_distance(distances);
+			if (!distance) {
+				continue;
+			}
+			const auto [current, inserted] = distances.insert({transition.source_, *distance + 1});
+			if (inserted) {
+				changed = true;
+			} else if (*distance + 1 < current->second) {
+				current->second = *distance + 1;
+				changed         = true;
+			}
+		}
+	}
+	return distances;
+}
+
+template <typename LocationT, typename SymbolT>
+std::map<LocationT, Endpoint>
+AlternatingTimedAutomaton<LocationT, SymbolT>::get_largest_constants() const
+{
+	std::map<LocationT, Endpoint> constants;
+	for (const auto &transition : transitions_) {
+		constants.insert({transition.source_, 0});
+	}
+	// Iterate until a fixed point is reached. Each iteration can only increase constants and they are
+	// bounded by the largest constant of all transitions, so this terminates.
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (const auto &transition : transitions_) {
+			const Endpoint constant = transition.formula_->get_largest_constant(constants);
+			if (auto &current = constants[transition.source_]; constant > current) {
+				current = constant;
+				changed = true;
+			}
+		}
+	}
+	return constants;
+}
+
 template <typename LocationT, typename SymbolT>
 [[nodiscard]] bool
 AlternatingTimedAutomaton<LocationT, SymbolT>::accepts_word(const TimedATAWord<SymbolT> &word) const
@@ -12,7 +12,9 @@
 #include "automata.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
+#include <optional>
 #include <range/v3/algorithm.hpp>
 #include <range/v3/view.hpp>
 #include <type_traits>
@@ -114,6 +116,26 @@ public:
 	 */
 	virtual std::set<std::set<State<LocationT>>>
 	get_minimal_models(const ClockValuation &v) const = 0;
+	/** @brief Compute a lower bound on the number of steps until the formula leads to an accepting
+	 * configuration.
+	 * Clock constraints are ignored, i.e., they are assumed to be satisfiable.
+	 * @param distances The distance of each location to an accepting configuration, a location that
+	 * is not contained cannot reach an accepting configuration
+	 * @return The distance of the best model of the formula, or nullopt if no model of the formula can
+	 * reach an accepting configuration
+	 */
+	virtual std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const = 0;
+	/** @brief Compute the largest constant that the current clock valuation is compared to.
+	 * This includes the constants of all locations that inherit the current clock valuation, i.e.,
+	 * that occur without a clock reset, as their clock constraints will be checked against the same
+	 * valuation later.
+	 * @param location_constants The largest constant of each location, a location that is not
+	 * contained is not compared to any constant
+	 * @return The largest constant the formula compares the current clock valuation to
+	 */
+	virtual Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const = 0;
 
 	// clang-format off
 	friend std::ostream & operator<< <>(std::ostream &os, const Formula &formula);
@@ -136,6 +158,10 @@ class TrueFormula : public Formula<LocationT>
 public:
 	bool is_satisfied(const std::set<State<LocationT>> &, const ClockValuation &) const override;
 	std::set<std::set<State<LocationT>>> get_minimal_models(const ClockValuation &) const override;
+	std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const override;
+	Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const override;
 
 protected:
 	/** Print a TrueFormula to an ostream
@@ -151,6 +177,10 @@ class FalseFormula : public Formula<LocationT>
 public:
 	bool is_satisfied(const std::set<State<LocationT>> &, const ClockValuation &) const override;
 	std::set<std::set<State<LocationT>>> get_minimal_models(const ClockValuation &) const override;
+	std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const override;
+	Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const override;
 
 protected:
 	/** Print a FalseFormula to an ostream
@@ -175,6 +205,10 @@ public:
 	bool                                 is_satisfied(const std::set<State<LocationT>> &states,
 	                                                  const ClockValuation &            v) const override;
 	std::set<std::set<State<LocationT>>> get_minimal_models(const ClockValuation &v) const override;
+	std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const override;
+	Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const override;
 
 protected:
 	/** Print a LocationFormula to an ostream
@@ -203,6 +237,10 @@ public:
 	}
 	bool is_satisfied(const std::set<State<LocationT>> &, const ClockValuation &v) const override;
 	std::set<std::set<State<LocationT>>> get_minimal_models(const ClockValuation &v) const override;
+	std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const override;
+	Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const override;
 
 protected:
 	/** Print a ClockConstraintFormula to an ostream
@@ -237,6 +275,10 @@ public:
 	                  const ClockValuation &            v) const override;
 
 	std::set<std::set<State<LocationT>>> get_minimal_models(const ClockValuation &v) const override;
+	std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const override;
+	Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const override;
 
 protected:
 	/** Print a ConjunctionFormula to an ostream
@@ -271,6 +313,10 @@ public:
 	bool                                 is_satisfied(const std::set<State<LocationT>> &states,
 	                                                  const ClockValuation &            v) const override;
 	std::set<std::set<State<LocationT>>> get_minimal_models(const ClockValuation &v) const override;
+	std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const override;
+	Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const override;
 
 protected:
 	/** Print a DisjunctionFormula to an ostream
@@ -302,6 +348,10 @@ public:
 	bool                                 is_satisfied(const std::set<State<LocationT>> &states,
 	                                                  const ClockValuation &) const override;
 	std::set<std::set<State<LocationT>>> get_minimal_models(const ClockValuation &) const override;
+	std::optional<std::size_t>
+	get_acceptance_distance(const std::map<LocationT, std::size_t> &distances) const override;
+	Endpoint
+	get_largest_constant(const std::map<LocationT, Endpoint> &location_constants) const override;
 
 protected:
 	/** Print a ResetClockFormula to an ostream
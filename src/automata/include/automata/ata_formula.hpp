@@ -49,6 +49,20 @@ TrueFormula<LocationT>::get_minimal_models(const ClockValuation &) const
 	return {{}};
 }
 
+template <typename LocationT>
+std::optional<std::size_t>
+TrueFormula<LocationT>::get_acceptance_distance(const std::map<LocationT, std::size_t> &) const
+{
+	return 0;
+}
+
+template <typename LocationT>
+Endpoint
+TrueFormula<LocationT>::get_largest_constant(const std::map<LocationT, Endpoint> &) const
+{
+	return 0;
+}
+
 template <typename LocationT>
 void
 TrueFormula<LocationT>::print_to_ostream(std::ostream &os) const
@@ -71,6 +85,20 @@ FalseFormula<LocationT>::get_minimal_models(const ClockValuation &) const
 	return {};
 }
 
+template <typename LocationT>
+std::optional<std::size_t>
+FalseFormula<LocationT>::get_acceptance_distance(const std::map<LocationT, std::size_t> &) const
+{
+	return std::nullopt;
+}
+
+template <typename LocationT>
+Endpoint
+FalseFormula<LocationT>::get_largest_constant(const std::map<LocationT, Endpoint> &) const
+{
+	return 0;
+}
+
 template <typename LocationT>
 void
 FalseFormula<LocationT>::print_to_ostream(std::ostream &os) const
@@ -93,6 +121,29 @@ LocationFormula<LocationT>::get_minimal_models(const ClockValuation &v) const
 	return {{State<LocationT>{location_, v}}};
 }
 
+template <typename LocationT>
+std::optional<std::size_t>
+LocationFormula<LocationT>::get_acceptance_distance(
+  const std::map<LocationT, std::size_t> &distances) const
+{
+	if (const auto distance = distances.find(location_); distance != std::end(distances)) {
+		return distance->second;
+	}
+	return std::nullopt;
+}
+
+template <typename LocationT>
+Endpoint
+LocationFormula<LocationT>::get_largest_constant(
+  const std::map<LocationT, Endpoint> &location_constants) const
+{
+	if (const auto constant = location_constants.find(location_);
+	    constant != std::end(location_constants)) {
+		return constant->second;
+	}
+	return 0;
+}
+
 template <typename LocationT>
 void
 LocationFormula<LocationT>::print_to_ostream(std::ostream &os) const
@@ -119,6 +170,23 @@ ClockConstraintFormula<LocationT>::get_minimal_models(const ClockValuation &v) c
 	}
 }
 
+template <typename LocationT>
+std::optional<std::size_t>
+ClockConstraintFormula<LocationT>::get_acceptance_distance(
+  const std::map<LocationT, std::size_t> &) const
+{
+	return 0;
+}
+
+template <typename LocationT>
+Endpoint
+ClockConstraintFormula<LocationT>::get_largest_constant(
+  const std::map<LocationT, Endpoint> &) const
+{
+	return std::visit([](const auto &constraint) { return constraint.get_comparand(); },
+	                  constraint_);
+}
+
 template <typename LocationT>
 void
 ClockConstraintFormula<LocationT>::print_to_ostream(std::ostream &os) const
@@ -150,6 +218,28 @@ ConjunctionFormula<LocationT>::get_minimal_models(const ClockValuation &v) const
 	return res;
 }
 
+template <typename LocationT>
+std::optional<std::size_t>
+ConjunctionFormula<LocationT>::get_acceptance_distance(
+  const std::map<LocationT, std::size_t> &distances) const
+{
+	const auto distance1 = conjunct1_->get_acceptance_distance(distances);
+	const auto distance2 = conjunct2_->get_acceptance_distance(distances);
+	if (!distance1 || !distance2) {
+		return std::nullopt;
+	}
+	return std::max(*distance1, *distance2);
+}
+
+template <typename LocationT>
+Endpoint
+ConjunctionFormula<LocationT>::get_largest_constant(
+  const std::map<LocationT, Endpoint> &location_constants) const
+{
+	return std::max(conjunct1_->get_largest_constant(location_constants),
+	                conjunct2_->get_largest_constant(location_constants));
+}
+
 template <typename LocationT>
 void
 ConjunctionFormula<LocationT>::print_to_ostream(std::ostream &os) const
@@ -202,6 +292,31 @@ DisjunctionFormula<LocationT>::get_minimal_models(const ClockValuation &v) const
 	return disjunct1_models;
 }
 
+template <typename LocationT>
+std::optional<std::size_t>
+DisjunctionFormula<LocationT>::get_acceptance_distance(
+  const std::map<LocationT, std::size_t> &distances) const
+{
+	const auto distance1 = disjunct1_->get_acceptance_distance(distances);
+	const auto distance2 = disjunct2_->get_acceptance_distance(distances);
+	if (!distance1) {
+		return distance2;
+	}
+	if (!distance2) {
+		return distance1;
+	}
+	return std::min(*distance1, *distance2);
+}
+
+template <typename LocationT>
+Endpoint
+DisjunctionFormula<LocationT>::get_largest_constant(
+  const std::map<LocationT, Endpoint> &location_constants) const
+{
+	return std::max(disjunct1_->get_largest_constant(location_constants),
+	                disjunct2_->get_largest_constant(location_constants));
+}
+
 template <typename LocationT>
 void
 DisjunctionFormula<LocationT>::print_to_ostream(std::ostream &os) const
@@ -224,6 +339,22 @@ ResetClockFormula<LocationT>::get_minimal_models(const ClockValuation &) const
 	return sub_formula_->get_minimal_models(0);
 }
 
+template <typename LocationT>
+std::optional<std::size_t>
+ResetClockFormula<LocationT>::get_acceptance_distance(
+  const std::map<LocationT, std::size_t> &distances) const
+{
+	return sub_formula_->get_acceptance_distance(distances);
+}
+
+template <typename LocationT>
+Endpoint
+ResetClockFormula<LocationT>::get_largest_constant(const std::map<LocationT, Endpoint> &) const
+{
+	// The sub-formula is evaluated with a reset clock, so it does not depend on the current value.
+	return 0;
+}
+
 template <typename LocationT>
 void
 ResetClockFormula<LocationT>::print_to_ostream(std::ostream &os) const
@@ -246,6 +246,45 @@ public:
 	// clang-format on
 
 	TimedAutomaton() = delete;
+	/** Copy a TimedAutomaton.
+	 * The transition index of the copy refers to the copy's own transitions.
+	 */
+	TimedAutomaton(const TimedAutomaton &other)
+	: alphabet_(other.alphabet_),
+	  locations_(other.locations_),
+	  initial_location_(other.initial_location_),
+	  final_locations_(other.final_locations_),
+	  clocks_(other.clocks_),
+	  transitions_(other.transitions_)
+	{
+		index_transitions();
+	}
+	/** Move a TimedAutomaton.
+	 * Moving keeps the nodes of the transition map, so the transition index stays valid.
+	 */
+	TimedAutomaton(TimedAutomaton &&other) = default;
+	/** Copy-assign a TimedAutomaton.
+	 * The transition index is rebuilt, so it refers to this automaton's own transitions.
+	 */
+	TimedAutomaton &
+	operator=(const TimedAutomaton &other)
+	{
+		if (this == &other) {
+			return *this;
+		}
+		alphabet_         = other.alphabet_;
+		locations_        = other.locations_;
+		initial_location_ = other.initial_location_;
+		final_locations_  = other.final_locations_;
+		clocks_           = other.clocks_;
+		transitions_      = other.transitions_;
+		index_transitions();
+		return *this;
+	}
+	/** Move-assign a TimedAutomaton.
+	 * Moving keeps the nodes of the transition map, so the transition index stays valid.
+	 */
+	TimedAutomaton &operator=(TimedAutomaton &&other) = default;
 	/** Constructor.
 	 * @param alphabet The valid symbols in the TimedAutomaton
 	 * @param initial_location the initial location
@@ -346,6 +385,17 @@ public:
 		return transitions_;
 	}
 
+	/** Get the transitions starting in a location with a given symbol.
+	 * The transitions are looked up in an index of the transitions grouped by source location and
+	 * symbol and are in the order in which they were added.
+	 * @param source The source location of the transitions
+	 * @param symbol The symbol of the transitions
+	 * @return Pointers to all transitions from the source location with the given symbol, which stay
+	 * valid as long as the TA is not destroyed
+	 */
+	const std::vector<const Transition *> &get_transitions(const Location &source,
+	                                                       const AP       &symbol) const;
+
 	/** Get the clock names of the automaton.
 	 * @return a set of clock names
 	 */
@@ -442,6 +492,12 @@ public:
 	 */
 	Endpoint get_largest_constant() const;
 
+	/** @brief Get the largest constant each clock is compared to.
+	 * Clocks that do not occur in any guard have the constant 0.
+	 * @return A map from each clock to its largest constant
+	 */
+	std::map<std::string, Endpoint> get_largest_constants() const;
+
 	/** Get the initial configuration of the automaton.
 	 * @return The initial configuration
 	 */
@@ -454,13 +510,36 @@ public:
 	[[nodiscard]] bool
 	is_accepting_configuration(const TAConfiguration<LocationT> &configuration) const;
 
+	/** Check if the given location is accepting.
+	 * As acceptance does not depend on the clock valuations, a configuration is accepting if and only
+	 * if its location is accepting.
+	 * @param location The location to check
+	 * @return true if the given location is a final location of this automaton
+	 */
+	[[nodiscard]] bool
+	is_accepting_location(const Location &location) const;
+
+	/** @brief Compute the distance of each location to a final location.
+	 * The distance is the minimal number of transitions to reach a final location, ignoring all
+	 * clock constraints. It is therefore a lower bound on the number of steps to reach an accepting
+	 * configuration.
+	 * @return A map from each location to its distance, locations that cannot reach a final location
+	 * are omitted
+	 */
+	[[nodiscard]] std::map<Location, std::size_t> get_acceptance_distances() const;
+
 private:
 	std::set<AP>                        alphabet_;
 	std::set<Location>                  locations_;
-	const Location                      initial_location_;
+	Location                            initial_location_;
 	std::set<Location>                  final_locations_;
 	std::set<std::string>               clocks_;
 	std::multimap<Location, Transition> transitions_;
+	/** Pointers into transitions_, grouped by their source location and symbol. */
+	std::map<Location, std::map<AP, std::vector<const Transition *>>> transition_index_;
+
+	/** Rebuild the transition index from all transitions. */
+	void index_transitions();
 };
 
 /** Print a multimap of transitions. */
@@ -12,6 +12,7 @@
 #include "ta.h"
 
 #include <algorithm>
+#include <deque>
 #include <iterator>
 
 namespace tacos::automata::ta {
@@ -173,7 +174,36 @@ TimedAutomaton<LocationT, AP>::add_transition(const Transition &transition)
 			throw InvalidClockException(clock_name);
 		};
 	}
-	transitions_.insert({transition.source_, transition});
+	// Nodes of a multimap are never moved, so the pointer stays valid.
+	const auto inserted = transitions_.insert({transition.source_, transition});
+	transition_index_[transition.source_][transition.symbol_].push_back(&inserted->second);
+}
+
+template <typename LocationT, typename AP>
+void
+TimedAutomaton<LocationT, AP>::index_transitions()
+{
+	transition_index_.clear();
+	// Transitions with the same source are in insertion order, so the index keeps that order.
+	for (const auto &[source, transition] : transitions_) {
+		transition_index_[source][transition.symbol_].push_back(&transition);
+	}
+}
+
+template <typename LocationT, typename AP>
+const std::vector<const Transition<LocationT, AP> *> &
+TimedAutomaton<LocationT, AP>::get_transitions(const Location &source, const AP &symbol) const
+{
+	static const std::vector<const Transition *> no_transitions;
+	const auto                                   location_it = transition_index_.find(source);
+	if (location_it == std::end(transition_index_)) {
+		return no_transitions;
+	}
+	const auto symbol_it = location_it->second.find(symbol);
+	if (symbol_it == std::end(location_it->second)) {
+		return no_transitions;
+	}
+	return symbol_it->second;
 }
 
 template <typename LocationT, typename AP>
@@ -182,22 +212,15 @@ TimedAutomaton<LocationT, AP>::make_symbol_step(const TAConfiguration<LocationT>
                                                 const AP &                        symbol) const
 {
 	std::set<TAConfiguration<LocationT>> res;
-	// TODO This may cause an issue if the transitions are not sorted as expected, because
-	// equal_range returns a sub-sequence
-	auto [first, last] = transitions_.equal_range(configuration.location);
-	while (first != last) {
-		auto trans = std::find_if(first, last, [&](const auto &trans) {
-			return trans.second.is_enabled(symbol, configuration.clock_valuations);
-		});
-		if (trans == last) {
-			return res;
+	for (const auto *transition : get_transitions(configuration.location, symbol)) {
+		if (!transition->is_enabled(symbol, configuration.clock_valuations)) {
+			continue;
 		}
-		first                         = std::next(trans);
 		ClockSetValuation next_clocks = configuration.clock_valuations;
-		for (const auto &name : trans->second.clock_resets_) {
+		for (const auto &name : transition->clock_resets_) {
 			next_clocks[name].reset();
 		}
-		res.insert(TAConfiguration<LocationT>{trans->second.target_, next_clocks});
+		res.insert(TAConfiguration<LocationT>{transition->target_, next_clocks});
 	}
 	return res;
 }
@@ -257,11 +280,14 @@ TimedAutomaton<LocationT, AP>::get_enabled_transitions(
   const TAConfiguration<LocationT> &configuration)
 {
 	std::vector<Transition> res;
-	for (const auto &symbol : alphabet_) {
-		for (const auto &[source, transition] : transitions_) {
-			if (source == configuration.location
-			    && transition.is_enabled(symbol, configuration.clock_valuations)) {
-				res.push_back(transition);
+	const auto              location_it = transition_index_.find(configuration.location);
+	if (location_it == std::end(transition_index_)) {
+		return res;
+	}
+	for (const auto &[symbol, transitions] : location_it->second) {
+		for (const auto *transition : transitions) {
+			if (transition->is_enabled(symbol, configuration.clock_valuations)) {
+				res.push_back(*transition);
 			}
 		}
 	}
@@ -285,6 +311,24 @@ TimedAutomaton<LocationT, AP>::get_largest_constant() const
 	return res;
 }
 
+template <typename LocationT, typename AP>
+std::map<std::string, Endpoint>
+TimedAutomaton<LocationT, AP>::get_largest_constants() const
+{
+	std::map<std::string, Endpoint> res;
+	for (const auto &clock : clocks_) {
+		res[clock] = 0;
+	}
+	for (const auto &[source, transition] : transitions_) {
+		for (const auto &[clock, constraint] : transition.get_guards()) {
+			const Endpoint candidate =
+			  std::visit([](const auto &c) { return c.get_comparand(); }, constraint);
+			res[clock] = std::max(res[clock], candidate);
+		}
+	}
+	return res;
+}
+
 template <typename LocationT, typename AP>
 TAConfiguration<LocationT>
 TimedAutomaton<LocationT, AP>::get_initial_configuration() const
@@ -301,7 +345,42 @@ template <typename LocationT, typename AP>
 TimedAutomaton<LocationT, AP>::is_accepting_configuration(
   const TAConfiguration<LocationT> &configuration) const
 {
-	return (final_locations_.find(configuration.location) != final_locations_.end());
+	return is_accepting_location(configuration.location);
+}
+
+template <typename LocationT, typename AP>
+[[nodiscard]] bool
+TimedAutomaton<LocationT, AP>::is_accepting_location(const Location &location) const
+{
+	return (final_locations_.find(location) != final_locations_.end());
+}
+
+template <typename LocationT, typename AP>
+std::map<Location<LocationT>, std::size_t>
+TimedAutomaton<LocationT, AP>::get_acceptance_distances() const
+{
+	std::multimap<Location, Location> predecessors;
+	for (const auto &[source, transition] : transitions_) {
+		predecessors.emplace(transition.target_, source);
+	}
+	// Backwards breadth-first search starting at the final locations.
+	std::map<Location, std::size_t> distances;
+	std::deque<Location>            queue;
+	for (const auto &location : final_locations_) {
+		distances[location] = 0;
+		queue.push_back(location);
+	}
+	while (!queue.empty()) {
+		const Location location = queue.front();
+		queue.pop_front();
+		const auto [first, last] = predecessors.equal_range(location);
+		for (auto predecessor = first; predecessor != last; ++predecessor) {
+			if (distances.insert({predecessor->second, distances.at(location) + 1}).second) {
+				queue.push_back(predecessor->second);
+			}
+		}
+	}
+	return distances;
 }
 
 } // namespace tacos::automata::ta
@@ -13,6 +13,7 @@
 #include "ta.h"
 
 #include <iostream>
+#include <thread>
 #include <tuple>
 
 namespace tacos::automata::ta {
@@ -68,15 +69,23 @@ collect_synchronizing_alphabets(const std::set<ActionT> &             synchroniz
  *    a. l1 -- (a, G1, Y1) -> l1' and l2' = l2, or
  *    b. l2 -- (a, G2, Y2) -> l2' and l1' = l1
  *
+ * The transitions of each symbol are computed independently in parallel.
+ *
  * @param ta1 The first timed automaton
  * @param ta2 The second timed automaton
  * @param synchronized_actions The actions on which the two TAs must synchronize
+ * @param reachable_only If true, construct the product by forward exploration from the initial
+ * location, such that it only contains the locations and transitions that are reachable in the
+ * untimed product graph
+ * @param num_threads The number of threads to use for computing the transitions
  * @return The product automaton
  */
 template <typename LocationT, typename ActionT>
 TimedAutomaton<std::vector<LocationT>, ActionT>
 get_product(const std::vector<TimedAutomaton<LocationT, ActionT>> &automata,
-            const std::set<ActionT> &                              synchronized_actions = {});
+            const std::set<ActionT> &                              synchronized_actions = {},
+            bool                                                   reachable_only       = false,
+            std::size_t num_threads = std::thread::hardware_concurrency());
 
 } // namespace tacos::automata::ta
 
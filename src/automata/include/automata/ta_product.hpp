@@ -11,6 +11,7 @@
 
 #include "automata/ta.h"
 #include "ta_product.h"
+#include "utilities/priority_thread_pool.h"
 
 #include <fmt/core.h>
 #include <fmt/format.h>
@@ -18,7 +19,6 @@
 #include <algorithm>
 #include <ctime>
 #include <iterator>
-#include <range/v3/view/enumerate.hpp>
 #include <stdexcept>
 #include <tuple>
 
@@ -41,10 +41,304 @@ collect_synchronizing_alphabets(const std::set<ActionT> &             synchroniz
 	return res;
 }
 
+namespace details {
+
+/** For each component of a product, map each location of the component to all product locations
+ * that contain this location. */
+template <typename LocationT>
+using ProductLocationIndex =
+  std::vector<std::map<LocationT, std::vector<Location<std::vector<LocationT>>>>>;
+
+/** Index the product locations by their components.
+ * @param product_locations The product locations to index
+ * @param num_automata The number of components of each product location
+ * @return For each component, a map from the component's location to all product locations that
+ * contain this location
+ */
+template <typename LocationT>
+ProductLocationIndex<LocationT>
+index_product_locations(const std::set<Location<std::vector<LocationT>>> &product_locations,
+                        std::size_t                                        num_automata)
+{
+	ProductLocationIndex<LocationT> index(num_automata);
+	for (const auto &product_location : product_locations) {
+		for (std::size_t i = 0; i < num_automata; ++i) {
+			index[i][product_location.get()[i]].push_back(product_location);
+		}
+	}
+	return index;
+}
+
+/** Compute all product transitions with the given symbol.
+ * @param automata The automata to compute the product of
+ * @param symbol The symbol of the transitions
+ * @param symbol_synchronizes True if the automata synchronize on the symbol
+ * @param location_index The product locations indexed by their components
+ * @return All product transitions with the given symbol
+ */
+template <typename LocationT, typename ActionT>
+std::vector<Transition<std::vector<LocationT>, ActionT>>
+get_product_transitions(const std::vector<TimedAutomaton<LocationT, ActionT>> &automata,
+                        const ActionT                                         &symbol,
+                        bool                                                   symbol_synchronizes,
+                        const ProductLocationIndex<LocationT>                 &location_index)
+{
+	std::vector<Transition<std::vector<LocationT>, ActionT>> product_transitions;
+	// collects synchronizing transitions
+	std::set<Transition<std::vector<LocationT>, ActionT>> synchronized_transitions;
+	for (std::size_t ta_i = 0; ta_i < automata.size(); ++ta_i) {
+		const auto &ta = automata[ta_i];
+		// before finalizing the construction for one automaton, we collect all candidates for
+		// synchronizing jumps to avoid expensive lookup.
+		std::set<Transition<std::vector<LocationT>, ActionT>> new_synchronizing_jumps;
+		for (const auto &source_location : ta.get_locations()) {
+			// Only consider transitions where the symbol matches. Note that if the automaton does not
+			// synchronize with this symbol, there are no such transitions since implicitly an automaton
+			// can only synchronize with a synchronizing symbol if it has at least one transition with
+			// this symbol.
+			const auto &transitions = ta.get_transitions(source_location, symbol);
+			if (transitions.empty()) {
+				continue;
+			}
+			const auto product_source_locations = location_index[ta_i].find(source_location.get());
+			for (const auto *transition : transitions) {
+				// Handling of non-synchronized transitions: insert transitions for all product locations
+				// where source and target of the local transition match.
+				if (!symbol_synchronizes) {
+					if (product_source_locations == std::end(location_index[ta_i])) {
+						continue;
+					}
+					for (const auto &product_source_location : product_source_locations->second) {
+						auto product_target_location        = product_source_location;
+						product_target_location.get()[ta_i] = transition->target_.get();
+						product_transitions.emplace_back(product_source_location,
+						                                 transition->symbol_,
+						                                 product_target_location,
+						                                 transition->clock_constraints_,
+						                                 transition->clock_resets_);
+					}
+				} else if (synchronized_transitions.empty()) {
+					// if this is the first synchronized transition with this symbol, initialize set of
+					// potentially synchronizing jumps.
+					if (product_source_locations == std::end(location_index[ta_i])) {
+						continue;
+					}
+					for (const auto &product_source_location : product_source_locations->second) {
+						auto product_target_location        = product_source_location;
+						product_target_location.get()[ta_i] = transition->target_.get();
+						new_synchronizing_jumps.emplace(product_source_location,
+						                                transition->symbol_,
+						                                product_target_location,
+						                                transition->clock_constraints_,
+						                                transition->clock_resets_);
+					}
+				} else {
+					// there are already transition-candidates for synchronization, we need to create
+					// candidates for each transition in the current automaton which also synchronizes.
+					for (const auto &sync_transition : synchronized_transitions) {
+						auto product_source_location        = sync_transition.source_;
+						product_source_location.get()[ta_i] = transition->source_.get();
+						auto product_target_location        = sync_transition.target_;
+						product_target_location.get()[ta_i] = transition->target_.get();
+						auto constraints                    = sync_transition.clock_constraints_;
+						constraints.insert(std::begin(transition->clock_constraints_),
+						                   std::end(transition->clock_constraints_));
+						auto resets = sync_transition.clock_resets_;
+						resets.insert(std::begin(transition->clock_resets_),
+						              std::end(transition->clock_resets_));
+						new_synchronizing_jumps.emplace(product_source_location,
+						                                transition->symbol_,
+						                                product_target_location,
+						                                constraints,
+						                                resets);
+					}
+				}
+			}
+		}
+		// update transitions
+		if (!new_synchronizing_jumps.empty()) {
+			synchronized_transitions = std::move(new_synchronizing_jumps);
+		}
+	}
+	std::copy(std::begin(synchronized_transitions),
+	          std::end(synchronized_transitions),
+	          std::back_inserter(product_transitions));
+	return product_transitions;
+}
+
+/** Compute the product transitions starting in the given product location.
+ * The transitions are ordered in the same way as in the full product, i.e., the non-synchronized
+ * transitions come first, followed by the synchronized transitions.
+ * @param automata The automata to compute the product of
+ * @param source The source location of the transitions
+ * @param symbols All symbols of the product, ordered
+ * @param synchronizing_automata For each synchronized symbol, the automata that have at least one
+ * transition with the symbol and therefore need to take part in each transition with the symbol
+ * @return All product transitions starting in the given location
+ */
+template <typename LocationT, typename ActionT>
+std::vector<Transition<std::vector<LocationT>, ActionT>>
+get_outgoing_product_transitions(
+  const std::vector<TimedAutomaton<LocationT, ActionT>> &automata,
+  const Location<std::vector<LocationT>>                &source,
+  const std::vector<ActionT>                            &symbols,
+  const std::map<ActionT, std::vector<std::size_t>>     &synchronizing_automata)
+{
+	std::vector<Transition<std::vector<LocationT>, ActionT>> product_transitions;
+	for (const auto &symbol : symbols) {
+		if (synchronizing_automata.count(symbol) > 0) {
+			continue;
+		}
+		for (std::size_t ta_i = 0; ta_i < automata.size(); ++ta_i) {
+			for (const auto *transition :
+			     automata[ta_i].get_transitions(Location<LocationT>{source.get()[ta_i]}, symbol)) {
+				auto target        = source;
+				target.get()[ta_i] = transition->target_.get();
+				product_transitions.emplace_back(source,
+				                                 symbol,
+				                                 target,
+				                                 transition->clock_constraints_,
+				                                 transition->clock_resets_);
+			}
+		}
+	}
+	for (const auto &[symbol, synchronizing] : synchronizing_automata) {
+		// Combine the transitions of all synchronizing automata, one automaton after the other.
+		std::set<Transition<std::vector<LocationT>, ActionT>> synchronized_transitions;
+		for (const auto &ta_i : synchronizing) {
+			const auto &transitions =
+			  automata[ta_i].get_transitions(Location<LocationT>{source.get()[ta_i]}, symbol);
+			std::set<Transition<std::vector<LocationT>, ActionT>> new_synchronizing_jumps;
+			for (const auto *transition : transitions) {
+				if (ta_i == synchronizing.front()) {
+					auto target        = source;
+					target.get()[ta_i] = transition->target_.get();
+					new_synchronizing_jumps.emplace(
+					  source, symbol, target, transition->clock_constraints_, transition->clock_resets_);
+					continue;
+				}
+				for (const auto &sync_transition : synchronized_transitions) {
+					auto target        = sync_transition.target_;
+					target.get()[ta_i] = transition->target_.get();
+					auto constraints   = sync_transition.clock_constraints_;
+					constraints.insert(std::begin(transition->clock_constraints_),
+					                   std::end(transition->clock_constraints_));
+					auto resets = sync_transition.clock_resets_;
+					resets.insert(std::begin(transition->clock_resets_),
+					              std::end(transition->clock_resets_));
+					new_synchronizing_jumps.emplace(source, symbol, target, constraints, resets);
+				}
+			}
+			synchronized_transitions = std::move(new_synchronizing_jumps);
+			if (synchronized_transitions.empty()) {
+				// One of the automata cannot take part in the synchronization.
+				break;
+			}
+		}
+		std::copy(std::begin(synchronized_transitions),
+		          std::end(synchronized_transitions),
+		          std::back_inserter(product_transitions));
+	}
+	return product_transitions;
+}
+
+/** Compute the product automaton by forward exploration of the untimed product graph.
+ * Starting from the initial location, only the locations and transitions that are reachable are
+ * added to the product. The locations of one exploration level are expanded in parallel.
+ */
+template <typename LocationT, typename ActionT>
+TimedAutomaton<std::vector<LocationT>, ActionT>
+get_reachable_product(const std::vector<TimedAutomaton<LocationT, ActionT>> &automata,
+                      const std::set<ActionT>                               &product_alphabet,
+                      const Location<std::vector<LocationT>>                &initial_location,
+                      const std::set<std::string>                           &product_clocks,
+                      const std::map<ActionT, std::vector<std::size_t>>     &synchronizing_actions,
+                      std::size_t                                            num_threads)
+{
+	using ProductLocation = Location<std::vector<LocationT>>;
+	const std::vector<ActionT> symbols{std::begin(product_alphabet), std::end(product_alphabet)};
+	// An automaton only needs to take part in a synchronized transition if it has at least one
+	// transition with the symbol.
+	std::map<ActionT, std::vector<std::size_t>> synchronizing_automata;
+	for (const auto &[symbol, synchronizing] : synchronizing_actions) {
+		auto &participants = synchronizing_automata[symbol];
+		std::copy_if(std::begin(synchronizing),
+		             std::end(synchronizing),
+		             std::back_inserter(participants),
+		             [&automata, &symbol = symbol](std::size_t ta_i) {
+			             const auto &locations = automata[ta_i].get_locations();
+			             return std::any_of(std::begin(locations),
+			                                std::end(locations),
+			                                [&](const auto &location) {
+				                                return !automata[ta_i]
+				                                          .get_transitions(location, symbol)
+				                                          .empty();
+			                                });
+		             });
+	}
+
+	std::set<ProductLocation>                                product_locations{initial_location};
+	std::vector<Transition<std::vector<LocationT>, ActionT>> product_transitions;
+	std::vector<ProductLocation>                             frontier{initial_location};
+	while (!frontier.empty()) {
+		std::vector<std::vector<Transition<std::vector<LocationT>, ActionT>>> outgoing(
+		  frontier.size());
+		{
+			utilities::ThreadPool<> pool{utilities::ThreadPool<>::StartOnInit::NO,
+			                             std::max(num_threads, std::size_t{1})};
+			for (std::size_t i = 0; i < frontier.size(); ++i) {
+				pool.add_job([&, i] {
+					outgoing[i] = get_outgoing_product_transitions(automata,
+					                                               frontier[i],
+					                                               symbols,
+					                                               synchronizing_automata);
+				});
+			}
+			pool.start();
+			pool.finish();
+		}
+		std::vector<ProductLocation> next_frontier;
+		for (auto &transitions : outgoing) {
+			for (auto &transition : transitions) {
+				if (product_locations.insert(transition.target_).second) {
+					next_frontier.push_back(transition.target_);
+				}
+				product_transitions.push_back(std::move(transition));
+			}
+		}
+		frontier = std::move(next_frontier);
+	}
+
+	std::set<ProductLocation> product_final_locations;
+	std::copy_if(std::begin(product_locations),
+	             std::end(product_locations),
+	             std::inserter(product_final_locations, std::end(product_final_locations)),
+	             [&automata](const ProductLocation &location) {
+		             for (std::size_t ta_i = 0; ta_i < automata.size(); ++ta_i) {
+			             if (automata[ta_i].get_final_locations().count(
+			                   Location<LocationT>{location.get()[ta_i]})
+			                 == 0) {
+				             return false;
+			             }
+		             }
+		             return true;
+	             });
+	return TimedAutomaton<std::vector<LocationT>, ActionT>{product_locations,
+	                                                       product_alphabet,
+	                                                       initial_location,
+	                                                       product_final_locations,
+	                                                       product_clocks,
+	                                                       product_transitions};
+}
+
+} // namespace details
+
 template <typename LocationT, typename ActionT>
 TimedAutomaton<std::vector<LocationT>, ActionT>
 get_product(const std::vector<TimedAutomaton<LocationT, ActionT>> &automata,
-            const std::set<ActionT> &                              synchronized_actions)
+            const std::set<ActionT> &                              synchronized_actions,
+            bool                                                   reachable_only,
+            std::size_t                                            num_threads)
 {
 	if (automata.empty()) {
 		throw std::invalid_argument("Cannot compute product of zero automata");
@@ -67,6 +361,30 @@ get_product(const std::vector<TimedAutomaton<LocationT, ActionT>> &automata,
 		}
 	}
 	using ProductLocation = Location<std::vector<LocationT>>;
+	std::set<ActionT>     product_alphabet;
+	ProductLocation       product_initial_location;
+	std::set<std::string> product_clocks;
+	// datastructures required for synchronization
+	std::vector<std::set<ActionT>> alphabets;
+	// build alphabet, initial location and clocks of the product
+	std::for_each(std::begin(automata), std::end(automata), [&](const auto &ta) {
+		alphabets.push_back(ta.get_alphabet());
+		product_alphabet.insert(std::begin(ta.get_alphabet()), std::end(ta.get_alphabet()));
+		product_initial_location->push_back(ta.get_initial_location().get());
+		product_clocks.insert(std::begin(ta.get_clocks()), std::end(ta.get_clocks()));
+	});
+	// collect which automata synchronize on which actions
+	const std::map<ActionT, std::vector<std::size_t>> synchronizing_actions =
+	  collect_synchronizing_alphabets(synchronized_actions, alphabets);
+	if (reachable_only) {
+		return details::get_reachable_product(automata,
+		                                      product_alphabet,
+		                                      product_initial_location,
+		                                      product_clocks,
+		                                      synchronizing_actions,
+		                                      num_threads);
+	}
+
 	std::set<ActionT>         actions;
 	std::set<ProductLocation> product_locations;
 	// Initialize the product locations with the locations from the first TA, by creating a set of
@@ -116,110 +434,38 @@ get_product(const std::vector<TimedAutomaton<LocationT, ActionT>> &automata,
 		                   return location.get().size() == automata.size();
 	                   }));
 
-	std::set<ActionT>                                        product_alphabet;
-	ProductLocation                                          product_initial_location;
-	std::set<std::string>                                    product_clocks;
+	const auto location_index = details::index_product_locations(product_locations, automata.size());
+
+	// The transitions of different symbols are independent of each other, compute them in parallel.
+	const std::vector<ActionT> symbols{std::begin(product_alphabet), std::end(product_alphabet)};
+	std::vector<std::vector<Transition<std::vector<LocationT>, ActionT>>> symbol_transitions(
+	  symbols.size());
+	{
+		utilities::ThreadPool<> pool{utilities::ThreadPool<>::StartOnInit::NO,
+		                             std::max(num_threads, std::size_t{1})};
+		for (std::size_t i = 0; i < symbols.size(); ++i) {
+			pool.add_job([&, i] {
+				symbol_transitions[i] =
+				  details::get_product_transitions(automata,
+				                                   symbols[i],
+				                                   synchronizing_actions.count(symbols[i]) > 0,
+				                                   location_index);
+			});
+		}
+		pool.start();
+		pool.finish();
+	}
+	// Add the non-synchronized transitions first, followed by the synchronized transitions.
 	std::vector<Transition<std::vector<LocationT>, ActionT>> product_transitions;
-	// datastructures required for synchronization
-	std::vector<std::set<ActionT>> alphabets;
-	// build alphabet, initial location and clocks of the product
-	std::for_each(std::begin(automata), std::end(automata), [&](const auto &ta) {
-		alphabets.push_back(ta.get_alphabet());
-		product_alphabet.insert(std::begin(ta.get_alphabet()), std::end(ta.get_alphabet()));
-		product_initial_location->push_back(ta.get_initial_location().get());
-		product_clocks.insert(std::begin(ta.get_clocks()), std::end(ta.get_clocks()));
-	});
-	// collect which automata synchronize on which actions
-	std::map<ActionT, std::vector<std::size_t>> synchronizing_actions =
-	  collect_synchronizing_alphabets(synchronized_actions, alphabets);
-	// collects synchronizing transitions
-	std::map<ActionT, std::set<Transition<std::vector<LocationT>, ActionT>>> synchronized_transitions;
-
-	for (const auto &symbol : product_alphabet) {
-		bool symbol_synchronizes =
-		  (synchronizing_actions.find(symbol) != std::end(synchronizing_actions));
-		for (const auto &[ta_i, ta] : ranges::views::enumerate(automata)) {
-			// before finalizing the construction for one automaton, we collect all candidates for
-			// synchronizing jumps to avoid expensive lookup.
-			std::map<ActionT, std::set<Transition<std::vector<LocationT>, ActionT>>>
-			  new_synchronizing_jumps;
-			for (const auto &[source_location, transition] : ta.get_transitions()) {
-				// Only consider transitions where the symbol matches. Note that if the automaton does not
-				// synchronize with this symbol, this check will always fail since implicitly an automaton
-				// can only synchronize with a synchronizing symbol if it has at least one transition with
-				// this symbol. This information is relevant to establish, that the automaton is able to
-				// synchronize with this symbol in the second case (else-branch below).
-				if (transition.symbol_ == symbol) {
-					// Handling of non-synchronized transitions: insert transitions for all product locations
-					// where source and target of the local transition match.
-					if (!symbol_synchronizes) {
-						for (const auto &product_source_location : product_locations) {
-							if (product_source_location.get()[ta_i] == transition.source_.get()) {
-								auto product_target_location        = product_source_location;
-								product_target_location.get()[ta_i] = transition.target_.get();
-								product_transitions.emplace_back(product_source_location,
-								                                 transition.symbol_,
-								                                 product_target_location,
-								                                 transition.clock_constraints_,
-								                                 transition.clock_resets_);
-							}
-						}
-					} else {
-						// We know the automaton *must* synchronize with the symbol
-						assert(std::find(std::begin(synchronizing_actions[symbol]),
-						                 std::end(synchronizing_actions[symbol]),
-						                 ta_i)
-						       != std::end(synchronizing_actions[symbol]));
-						// if this is the first synchronized transition with this symbol, initialize set of
-						// potentially synchronizing jumps.
-						if (synchronized_transitions[symbol].empty()) {
-							for (const auto &product_source_location : product_locations) {
-								if (product_source_location.get()[ta_i] == transition.source_.get()) {
-									auto product_target_location        = product_source_location;
-									product_target_location.get()[ta_i] = transition.target_.get();
-									new_synchronizing_jumps[symbol].emplace(product_source_location,
-									                                        transition.symbol_,
-									                                        product_target_location,
-									                                        transition.clock_constraints_,
-									                                        transition.clock_resets_);
-								}
-							}
-						} else {
-							// there are already transition-candidates for synchronization, we need to create
-							// candidates for each transition in the current automaton which also synchronizes.
-							for (const auto &sync_transition : synchronized_transitions[symbol]) {
-								auto product_source_location        = sync_transition.source_;
-								product_source_location.get()[ta_i] = transition.source_.get();
-								auto product_target_location        = sync_transition.target_;
-								product_target_location.get()[ta_i] = transition.target_.get();
-								auto constraints                    = sync_transition.clock_constraints_;
-								constraints.insert(std::begin(transition.clock_constraints_),
-								                   std::end(transition.clock_constraints_));
-								auto resets = sync_transition.clock_resets_;
-								resets.insert(std::begin(transition.clock_resets_),
-								              std::end(transition.clock_resets_));
-								new_synchronizing_jumps[symbol].emplace(product_source_location,
-								                                        transition.symbol_,
-								                                        product_target_location,
-								                                        constraints,
-								                                        resets);
-							}
-						}
-					}
-				}
-			}
-			// update transitions
-			for (const auto &[symbol, transitions] : new_synchronizing_jumps) {
-				synchronized_transitions[symbol] = std::move(transitions);
+	for (bool synchronized : {false, true}) {
+		for (std::size_t i = 0; i < symbols.size(); ++i) {
+			if ((synchronizing_actions.count(symbols[i]) > 0) == synchronized) {
+				std::move(std::begin(symbol_transitions[i]),
+				          std::end(symbol_transitions[i]),
+				          std::back_inserter(product_transitions));
 			}
 		}
 	}
-	// update transitions
-	for (const auto &[symbol, transitions] : synchronized_transitions) {
-		std::copy(std::begin(transitions),
-		          std::end(transitions),
-		          std::back_inserter(product_transitions));
-	}
 
 	return TimedAutomaton<std::vector<LocationT>, ActionT>{product_locations,
 	                                                       product_alphabet,
@@ -16,8 +16,14 @@
 namespace tacos::automata::ta {
 
 TimedAutomaton<std::string, std::string> parse_proto(const proto::TimedAutomaton &ta_proto);
+/** Parse a product automaton from a proto and compute the product.
+ * @param ta_product_proto The proto containing the automata of the product
+ * @param reachable_only If true, only construct the part of the product that is reachable from the
+ * initial location
+ * @return The product automaton
+ */
 TimedAutomaton<std::vector<std::string>, std::string>
-parse_product_proto(const proto::ProductAutomaton &ta_product_proto);
+parse_product_proto(const proto::ProductAutomaton &ta_product_proto, bool reachable_only = false);
 
 template <typename LocationT, typename ActionT>
 proto::TimedAutomaton ta_to_proto(const TimedAutomaton<LocationT, ActionT> &ta);
@@ -0,0 +1,157 @@
+/***************************************************************************
+ *  ta_region_graph.h - The region graph of a timed automaton
+ *
+ *  Created:   Fri 16 Oct 2026 12:35:06 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+
+#ifndef SRC_AUTOMATA_INCLUDE_AUTOMATA_TA_REGION_GRAPH_H
+#define SRC_AUTOMATA_INCLUDE_AUTOMATA_TA_REGION_GRAPH_H
+
+#include "ta.h"
+#include "ta_regions.h"
+
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace tacos::automata::ta {
+
+/** Get the regionalized configuration of a TA configuration.
+ * @param configuration The configuration to regionalize
+ * @param K The largest constant any clock may be compared to
+ * @return The configuration where each clock valuation is replaced by its region index
+ */
+template <typename LocationT>
+RegionalizedConfiguration<LocationT>
+get_regionalized_configuration(const TAConfiguration<LocationT> &configuration, RegionIndex K);
+
+/** @brief The region graph of a timed automaton.
+ * The region graph contains all regionalized configurations (location, region valuation) that are
+ * reachable from the initial configuration, along with the transitions that are enabled in each
+ * configuration. The graph is explored on regions, which additionally keep the order of the
+ * fractional parts of the clocks. Thus, each region has at most one direct time successor, just
+ * like a canonical word, and only reachable configurations are part of the graph. The transitions
+ * enabled in a regionalized configuration only depend on the region indexes, so they are stored
+ * for each configuration rather than for each region.
+ * The graph is computed once on construction, the expansion of each level of the graph is split
+ * among multiple threads. The graph keeps pointers to the transitions of the timed automaton, hence
+ * the timed automaton must not be modified during the lifetime of the graph.
+ */
+template <typename LocationT, typename AP>
+class RegionGraph
+{
+public:
+	/** The type of a node in the graph. */
+	using Configuration = RegionalizedConfiguration<LocationT>;
+	/** The transition type of the timed automaton. */
+	using Transition = automata::ta::Transition<LocationT, AP>;
+	/** The enabled transitions of a configuration, grouped by their symbol. */
+	using EnabledTransitions = std::map<AP, std::vector<const Transition *>>;
+
+	/** @brief A region of the timed automaton, i.e., a configuration together with the order of the
+	 * fractional parts of its clocks. */
+	struct Region
+	{
+		/** The location and the region index of each clock. */
+		Configuration configuration;
+		/** The clocks with an odd region index below the maximal region index, grouped by equal
+		 * fractional parts and sorted by increasing fractional part. All other clocks either have
+		 * an integer valuation or are beyond the largest constant. */
+		std::vector<std::set<std::string>> fractional_order;
+
+		/** Compare two regions lexicographically. */
+		bool
+		operator<(const Region &other) const
+		{
+			return std::tie(configuration, fractional_order)
+			       < std::tie(other.configuration, other.fractional_order);
+		}
+
+		/** Check two regions for equality. */
+		bool
+		operator==(const Region &other) const
+		{
+			return configuration == other.configuration && fractional_order == other.fractional_order;
+		}
+	};
+
+	/** Compute the region graph of a timed automaton.
+	 * @param ta The timed automaton to compute the region graph of
+	 * @param K The largest constant any clock may be compared to, must be at least as large as the
+	 * TA's largest constant
+	 * @param num_threads The number of threads to use for the computation
+	 */
+	RegionGraph(const TimedAutomaton<LocationT, AP> &ta,
+	            RegionIndex                          K,
+	            std::size_t                          num_threads = std::thread::hardware_concurrency());
+
+	/** Get the largest constant that was used to regionalize the clock valuations. */
+	RegionIndex
+	get_max_constant() const
+	{
+		return K_;
+	}
+
+	/** Get the number of configurations in the graph. */
+	std::size_t
+	size() const
+	{
+		return enabled_transitions_.size();
+	}
+
+	/** Check if the graph contains the given configuration.
+	 * @param configuration The configuration to check
+	 * @return true if the configuration is part of the graph
+	 */
+	bool
+	contains(const Configuration &configuration) const
+	{
+		return enabled_transitions_.find(configuration) != std::end(enabled_transitions_);
+	}
+
+	/** Get the transitions that are enabled in the given configuration.
+	 * @param configuration The configuration to get the enabled transitions of
+	 * @return A pointer to the enabled transitions grouped by symbol, or nullptr if the configuration
+	 * is not part of the graph
+	 */
+	const EnabledTransitions *get_enabled_transitions(const Configuration &configuration) const;
+
+	/** Get the successors of the given configuration when reading the given symbol.
+	 * @param configuration The configuration to compute the successors of
+	 * @param symbol The symbol to read
+	 * @return The regionalized configurations after taking all enabled transitions with the symbol
+	 */
+	std::set<Configuration> get_symbol_successors(const Configuration &configuration,
+	                                              const AP            &symbol) const;
+
+	/** Get the direct time successor of the given region.
+	 * If a clock has an integer valuation, all such clocks move to the next region and get the
+	 * smallest fractional part. Otherwise, the clocks with the largest fractional part reach the
+	 * next integer. As in get_time_successor for canonical words, there is thus at most one direct
+	 * time successor, so a region only has as many time successors as there are regions.
+	 * @param region The region to compute the time successor of
+	 * @return The direct time successor, or nullopt if all clocks are beyond the largest constant
+	 */
+	std::optional<Region> get_time_successor(const Region &region) const;
+
+private:
+	EnabledTransitions compute_enabled_transitions(const Configuration &configuration) const;
+	Region             get_symbol_successor(const Region &region, const Transition &transition) const;
+
+	const TimedAutomaton<LocationT, AP> *ta_;
+	const RegionIndex                    K_;
+	std::map<Configuration, EnabledTransitions> enabled_transitions_;
+};
+
+} // namespace tacos::automata::ta
+
+#include "ta_region_graph.hpp"
+
+#endif /* ifndef SRC_AUTOMATA_INCLUDE_AUTOMATA_TA_REGION_GRAPH_H */
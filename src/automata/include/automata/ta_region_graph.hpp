@@ -0,0 +1,212 @@
+/***************************************************************************
+ *  ta_region_graph.hpp - The region graph of a timed automaton
+ *
+ *  Created:   Fri 16 Oct 2026 12:35:06 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+
+#pragma once
+
+#include "ta_region_graph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+
+namespace tacos::automata::ta {
+
+namespace details {
+
+/** Take a transition in a regionalized configuration, i.e., switch to the target location and set
+ * the region index of each reset clock to 0. */
+template <typename LocationT, typename AP>
+RegionalizedConfiguration<LocationT>
+apply_transition(const RegionalizedConfiguration<LocationT> &configuration,
+                 const Transition<LocationT, AP>            &transition)
+{
+	RegionalizedConfiguration<LocationT> res{transition.get_target(), configuration.second};
+	for (const auto &clock : transition.get_reset()) {
+		res.second[clock] = 0;
+	}
+	return res;
+}
+
+} // namespace details
+
+template <typename LocationT>
+RegionalizedConfiguration<LocationT>
+get_regionalized_configuration(const TAConfiguration<LocationT> &configuration, RegionIndex K)
+{
+	TimedAutomatonRegions                regions{K};
+	RegionalizedConfiguration<LocationT> res;
+	res.first = configuration.location;
+	for (const auto &[clock_name, clock] : configuration.clock_valuations) {
+		res.second.emplace(clock_name, regions.getRegionIndex(clock.get_valuation()));
+	}
+	return res;
+}
+
+template <typename LocationT, typename AP>
+RegionGraph<LocationT, AP>::RegionGraph(const TimedAutomaton<LocationT, AP> &ta,
+                                        RegionIndex                          K,
+                                        std::size_t                          num_threads)
+: ta_(&ta), K_(K)
+{
+	num_threads = std::max(num_threads, std::size_t{1});
+	// The initial configuration only has integer clock valuations.
+	std::vector<Region> frontier{
+	  Region{get_regionalized_configuration(ta.get_initial_configuration(), K_), {}}};
+	std::set<Region> visited{frontier.front()};
+	// Expand the graph level by level. All regions of one level are expanded in parallel, the
+	// results are merged into the graph once the whole level has been expanded.
+	while (!frontier.empty()) {
+		std::vector<EnabledTransitions> enabled(frontier.size());
+		std::vector<std::set<Region>>   successors(num_threads);
+		std::atomic<std::size_t>        next_index{0};
+		auto expand = [&](std::size_t thread_index) {
+			for (std::size_t i = next_index++; i < frontier.size(); i = next_index++) {
+				enabled[i] = compute_enabled_transitions(frontier[i].configuration);
+				for (const auto &[symbol, transitions] : enabled[i]) {
+					for (const auto &transition : transitions) {
+						successors[thread_index].insert(get_symbol_successor(frontier[i], *transition));
+					}
+				}
+				if (auto successor = get_time_successor(frontier[i])) {
+					successors[thread_index].insert(std::move(*successor));
+				}
+			}
+		};
+		std::vector<std::thread> threads;
+		for (std::size_t thread_index = 1;
+		     thread_index < std::min(num_threads, frontier.size());
+		     ++thread_index) {
+			threads.emplace_back(expand, thread_index);
+		}
+		expand(0);
+		for (auto &thread : threads) {
+			thread.join();
+		}
+		for (std::size_t i = 0; i < frontier.size(); ++i) {
+			// Regions with the same configuration have the same enabled transitions.
+			enabled_transitions_.emplace(std::move(frontier[i].configuration), std::move(enabled[i]));
+		}
+		frontier.clear();
+		for (auto &thread_successors : successors) {
+			for (auto &successor : thread_successors) {
+				if (visited.insert(successor).second) {
+					frontier.push_back(successor);
+				}
+			}
+		}
+	}
+}
+
+template <typename LocationT, typename AP>
+typename RegionGraph<LocationT, AP>::EnabledTransitions
+RegionGraph<LocationT, AP>::compute_enabled_transitions(const Configuration &configuration) const
+{
+	EnabledTransitions res;
+	// All clock valuations in the same region satisfy the same constraints, so it suffices to check
+	// the transitions on a single representative of the region.
+	const auto candidate = get_region_candidate(configuration);
+	for (const auto &symbol : ta_->get_alphabet()) {
+		for (const auto *transition : ta_->get_transitions(configuration.first, symbol)) {
+			if (transition->is_enabled(symbol, candidate.clock_valuations)) {
+				res[symbol].push_back(transition);
+			}
+		}
+	}
+	return res;
+}
+
+template <typename LocationT, typename AP>
+const typename RegionGraph<LocationT, AP>::EnabledTransitions *
+RegionGraph<LocationT, AP>::get_enabled_transitions(const Configuration &configuration) const
+{
+	if (auto it = enabled_transitions_.find(configuration); it != std::end(enabled_transitions_)) {
+		return &it->second;
+	}
+	return nullptr;
+}
+
+template <typename LocationT, typename AP>
+std::set<typename RegionGraph<LocationT, AP>::Configuration>
+RegionGraph<LocationT, AP>::get_symbol_successors(const Configuration &configuration,
+                                                  const AP            &symbol) const
+{
+	std::set<Configuration> res;
+	const EnabledTransitions *enabled = get_enabled_transitions(configuration);
+	if (enabled == nullptr) {
+		return res;
+	}
+	if (auto transitions = enabled->find(symbol); transitions != std::end(*enabled)) {
+		for (const auto &transition : transitions->second) {
+			res.insert(details::apply_transition(configuration, *transition));
+		}
+	}
+	return res;
+}
+
+template <typename LocationT, typename AP>
+typename RegionGraph<LocationT, AP>::Region
+RegionGraph<LocationT, AP>::get_symbol_successor(const Region &region,
+                                                 const Transition &transition) const
+{
+	Region res{details::apply_transition(region.configuration, transition), {}};
+	// Reset clocks have an integer valuation and are therefore no longer ordered.
+	for (const auto &clocks : region.fractional_order) {
+		std::set<std::string> remaining;
+		std::set_difference(std::begin(clocks),
+		                    std::end(clocks),
+		                    std::begin(transition.get_reset()),
+		                    std::end(transition.get_reset()),
+		                    std::inserter(remaining, std::end(remaining)));
+		if (!remaining.empty()) {
+			res.fractional_order.push_back(std::move(remaining));
+		}
+	}
+	return res;
+}
+
+template <typename LocationT, typename AP>
+std::optional<typename RegionGraph<LocationT, AP>::Region>
+RegionGraph<LocationT, AP>::get_time_successor(const Region &region) const
+{
+	const RegionIndex     max_region_index = 2 * K_ + 1;
+	std::set<std::string> integer_clocks;
+	for (const auto &[clock, region_index] : region.configuration.second) {
+		if (region_index < max_region_index && region_index % 2 == 0) {
+			integer_clocks.insert(clock);
+		}
+	}
+	Region successor = region;
+	if (!integer_clocks.empty()) {
+		// Any delay moves all clocks with integer valuation into the next region, where they have the
+		// smallest fractional part.
+		std::set<std::string> new_fractional_clocks;
+		for (const auto &clock : integer_clocks) {
+			if (++successor.configuration.second[clock] < max_region_index) {
+				new_fractional_clocks.insert(clock);
+			}
+		}
+		if (!new_fractional_clocks.empty()) {
+			successor.fractional_order.insert(std::begin(successor.fractional_order),
+			                                  std::move(new_fractional_clocks));
+		}
+		return successor;
+	}
+	if (successor.fractional_order.empty()) {
+		// All clocks are beyond the largest constant.
+		return std::nullopt;
+	}
+	// The clocks with the largest fractional part are the first to reach the next integer.
+	for (const auto &clock : successor.fractional_order.back()) {
+		++successor.configuration.second[clock];
+	}
+	successor.fractional_order.pop_back();
+	return successor;
+}
+
+} // namespace tacos::automata::ta
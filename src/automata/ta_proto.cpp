@@ -122,13 +122,13 @@ parse_proto(const proto::TimedAutomaton &ta_proto)
 }
 
 TimedAutomaton<std::vector<std::string>, std::string>
-parse_product_proto(const proto::ProductAutomaton &ta_product_proto)
+parse_product_proto(const proto::ProductAutomaton &ta_product_proto, bool reachable_only)
 {
 	std::vector<TimedAutomaton<std::string, std::string>> automata;
 	std::for_each(std::begin(ta_product_proto.automata()),
 	              std::end(ta_product_proto.automata()),
 	              [&automata](const auto &ta_proto) { automata.push_back(parse_proto(ta_proto)); });
-	return get_product(automata);
+	return get_product(automata, {}, reachable_only);
 }
 
 } // namespace tacos::automata::ta
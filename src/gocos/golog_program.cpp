@@ -92,8 +92,13 @@ GologProgram::get_initial_configuration() const
 bool
 GologProgram::is_accepting_configuration(const GologConfiguration &configuration) const
 {
-	return gologpp::is_final(*configuration.location.remaining_program,
-	                         *configuration.location.history);
+	return is_accepting_location(configuration.location);
+}
+
+bool
+GologProgram::is_accepting_location(const GologLocation &location) const
+{
+	return gologpp::is_final(*location.remaining_program, *location.history);
 }
 
 std::set<std::string>
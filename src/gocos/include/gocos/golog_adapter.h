@@ -64,7 +64,8 @@ public:
 	                                                 logic::AtomicProposition<ATAInputType>> &ata,
 	  const std::pair<GologConfiguration, ATAConfiguration<std::string>> &ab_configuration,
 	  const RegionIndex                                                   increment,
-	  const RegionIndex                                                   K);
+	  const MaxConstants<std::string>                                    &K,
+	  SearchStatistics                                                   *statistics = nullptr);
 
 private:
 	std::set<std::string> controller_actions;
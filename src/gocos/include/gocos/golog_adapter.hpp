@@ -37,15 +37,22 @@ operator()(
                                                  logic::AtomicProposition<ATAInputType>> &ata,
   const std::pair<GologConfiguration, ATAConfiguration<std::string>> &ab_configuration,
   [[maybe_unused]] const RegionIndex                                  increment,
-  const RegionIndex                                                   K)
+  const MaxConstants<std::string>                                    &K,
+  SearchStatistics                                                   *statistics)
 {
 	std::multimap<std::string, CanonicalABWord<GologLocation, std::string>> successors;
 	const auto &[remaining_program, history] = ab_configuration.first.location;
-	auto golog_successors =
-	  program.get_semantics().trans_all(*history,
-	                                    remaining_program.get(),
-	                                    details::get_clock_values(
-	                                      ab_configuration.first.clock_valuations));
+	std::chrono::nanoseconds *const plant_step_time =
+	  statistics == nullptr ? nullptr : &statistics->plant_step_time;
+	std::chrono::nanoseconds *const ata_step_time =
+	  statistics == nullptr ? nullptr : &statistics->ata_step_time;
+	auto golog_successors = [&]() {
+		ScopedTimer timer{plant_step_time};
+		return program.get_semantics().trans_all(*history,
+		                                         remaining_program.get(),
+		                                         details::get_clock_values(
+		                                           ab_configuration.first.clock_valuations));
+	}();
 	for (const auto &golog_successor : golog_successors) {
 		const auto &[plan, program_suffix, new_history] = golog_successor;
 		const std::string action                        = plan->elements().front().instruction().str();
@@ -59,6 +66,7 @@ operator()(
 			clock_valuations.erase("golog");
 		}
 		const auto ata_successors = [&]() {
+			ScopedTimer timer{ata_step_time};
 			if constexpr (use_location_constraints) {
 				return ata.make_symbol_step(ab_configuration.second,
 				                            program.get_satisfied_fluents(*std::get<2>(golog_successor)));
@@ -99,6 +99,9 @@ public:
 	/** Check if a program is accepting, i.e., terminates, in the given configuration. */
 	bool is_accepting_configuration(const GologConfiguration &configuration) const;
 
+	/** Check if a program is accepting, i.e., terminates, in the given location. */
+	bool is_accepting_location(const GologLocation &location) const;
+
 	/** Get the satisfied fluents at the point of the given history. */
 	std::set<std::string> get_satisfied_fluents(const gologpp::History &history) const;
 
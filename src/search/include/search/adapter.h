@@ -9,6 +9,7 @@
 #pragma once
 
 #include "search/canonical_word.h"
+#include "search/search_statistics.h"
 
 #include <map>
 
@@ -29,7 +30,8 @@ public:
 	get_next_canonical_words(const std::set<ActionType> & = {}, const std::set<ActionType> & = {})
 	{
 	}
-	/** Get all successors for one particular time successor. */
+	/** Get all successors for one particular time successor.
+	 * If statistics are given, the time spent in plant and ATA steps is added to them. */
 	std::multimap<ActionType, CanonicalABWord<typename Plant::Location, ConstraintSymbolType>>
 	operator()(
 	  const Plant &,
@@ -38,7 +40,8 @@ public:
 	    &,
 	  const std::pair<typename Plant::Configuration, ATAConfiguration<ConstraintSymbolType>> &,
 	  const RegionIndex,
-	  const RegionIndex)
+	  const MaxConstants<ConstraintSymbolType> &,
+	  SearchStatistics * = nullptr)
 	{
 		throw std::logic_error("Missing specialization for get_next_canonical_words, did you forget to "
 		                       "include the adapter specialization?");
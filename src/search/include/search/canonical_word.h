@@ -13,8 +13,13 @@
 #include "automata/ta_regions.h"
 #include "mtl/MTLFormula.h"
 #include "utilities/numbers.h"
+#include "utilities/type_traits.h"
 #include "utilities/types.h"
 
+#include <algorithm>
+#include <map>
+#include <string>
+
 /** Get the regionalized synchronous product of a TA and an ATA. */
 namespace tacos::search {
 
@@ -169,6 +174,104 @@ get_region_index(const ABRegionSymbol<Location, ConstraintSymbolType> &w)
 	}
 }
 
+/** @brief The maximal constant of each plant clock and each ATA location.
+ * All clock valuations above the maximal constant of a clock are indistinguishable, so the region
+ * index of a clock is bounded by 2K+1, where K is the clock's maximal constant. Using a separate
+ * constant for each plant clock and each ATA location instead of the largest constant of the whole
+ * problem results in a coarser, but still exact, abstraction with fewer canonical words. The
+ * constant of an ATA location must also bound the constants of all locations that inherit its
+ * clock valuation, see AlternatingTimedAutomaton::get_largest_constants. Clocks and locations
+ * without a specific constant use the default constant.
+ * @tparam ConstraintSymbolType The type of the constraint symbols of the specification
+ */
+template <typename ConstraintSymbolType>
+struct MaxConstants
+{
+	/** Use the same constant for all clocks and locations.
+	 * This is intentionally implicit, such that a single constant can be used wherever maximal
+	 * constants are expected.
+	 * @param default_constant The maximal constant of all clocks and locations
+	 */
+	MaxConstants(RegionIndex default_constant = 0) : default_constant(default_constant)
+	{
+	}
+
+	/** Use a separate constant for each plant clock and ATA location.
+	 * @param default_constant The maximal constant of all other clocks and locations
+	 * @param clock_constants The maximal constant of each plant clock
+	 * @param location_constants The maximal constant of each ATA location
+	 */
+	MaxConstants(RegionIndex                                                    default_constant,
+	             std::map<std::string, RegionIndex>                             clock_constants,
+	             std::map<logic::MTLFormula<ConstraintSymbolType>, RegionIndex> location_constants)
+	: default_constant(default_constant),
+	  clock_constants(std::move(clock_constants)),
+	  location_constants(std::move(location_constants))
+	{
+	}
+
+	/** Get the maximal constant of a plant clock. */
+	RegionIndex
+	get_clock_constant(const std::string &clock) const
+	{
+		const auto constant = clock_constants.find(clock);
+		return constant == std::end(clock_constants) ? default_constant : constant->second;
+	}
+
+	/** Get the maximal constant of an ATA location. */
+	RegionIndex
+	get_location_constant(const logic::MTLFormula<ConstraintSymbolType> &location) const
+	{
+		const auto constant = location_constants.find(location);
+		return constant == std::end(location_constants) ? default_constant : constant->second;
+	}
+
+	/** Get the maximal region index of a symbol of a canonical word. */
+	template <typename Location>
+	RegionIndex
+	get_max_region_index(const ABRegionSymbol<Location, ConstraintSymbolType> &symbol) const
+	{
+		if (const auto *state = std::get_if<PlantRegionState<Location>>(&symbol)) {
+			return 2 * get_clock_constant(state->clock) + 1;
+		}
+		return 2 * get_location_constant(std::get<ATARegionState<ConstraintSymbolType>>(symbol).formula)
+		       + 1;
+	}
+
+	/** Get the largest of all constants. */
+	RegionIndex
+	get_largest_constant() const
+	{
+		RegionIndex res = default_constant;
+		for (const auto &[clock, constant] : clock_constants) {
+			res = std::max(res, constant);
+		}
+		for (const auto &[location, constant] : location_constants) {
+			res = std::max(res, constant);
+		}
+		return res;
+	}
+
+	/** Get the largest region index of any symbol. */
+	RegionIndex
+	get_max_region_index() const
+	{
+		return 2 * get_largest_constant() + 1;
+	}
+
+	/** The constant of all clocks and locations without a specific constant */
+	RegionIndex default_constant;
+	/** The maximal constant of each plant clock */
+	std::map<std::string, RegionIndex> clock_constants;
+	/** The maximal constant of each ATA location */
+	std::map<logic::MTLFormula<ConstraintSymbolType>, RegionIndex> location_constants;
+};
+
+/** Maximal constants as function parameter. The constraint symbol type is not deduced from the
+ * argument, so a single RegionIndex can be passed as the maximal constant of all clocks. */
+template <typename ConstraintSymbolType>
+using MaxConstantsParam = utilities::type_identity_t<MaxConstants<ConstraintSymbolType>>;
+
 /** Thrown if a canonical word is not valid. */
 class InvalidCanonicalWordException : public std::domain_error
 {
@@ -283,7 +386,8 @@ is_valid_canonical_word(const CanonicalABWord<Location, ConstraintSymbolType> &w
  * @param plant_configuration The configuration of the plant A (e.g., a TA
  * configuration)
  * @param ata_configuration The configuration of the alternating timed automaton B
- * @param K The value of the largest constant any clock may be compared to
+ * @param K The value of the largest constant any clock may be compared to, either a single
+ * constant or the maximal constant of each clock
  * @return The canonical word representing the state s, as a sorted vector of
  * sets of tuples (triples from A and pairs from B).
  */
@@ -291,7 +395,7 @@ template <typename Location, typename ConstraintSymbolType>
 CanonicalABWord<Location, ConstraintSymbolType>
 get_canonical_word(const PlantConfiguration<Location>           &plant_configuration,
                    const ATAConfiguration<ConstraintSymbolType> &ata_configuration,
-                   const unsigned int                            K)
+                   const MaxConstantsParam<ConstraintSymbolType> &K)
 {
 	using ABSymbol       = ABSymbol<Location, ConstraintSymbolType>;
 	using ABRegionSymbol = ABRegionSymbol<Location, ConstraintSymbolType>;
@@ -314,7 +418,6 @@ get_canonical_word(const PlantConfiguration<Location>           &plant_configura
 		  symbol);
 	}
 	// Replace exact clock values by region indices.
-	automata::ta::TimedAutomatonRegions             regionSet{K};
 	CanonicalABWord<Location, ConstraintSymbolType> abs;
 	for (const auto &[fractional_part, g_i] : partitioned_g) {
 		std::set<ABRegionSymbol> abs_i;
@@ -325,18 +428,20 @@ get_canonical_word(const PlantConfiguration<Location>           &plant_configura
 		  [&](const ABSymbol &w) -> ABRegionSymbol {
 			  if (std::holds_alternative<PlantState<Location>>(w)) {
 				  const PlantState<Location> &s = std::get<PlantState<Location>>(w);
+				  automata::ta::TimedAutomatonRegions regions{K.get_clock_constant(s.clock)};
 				  return PlantRegionState<Location>{s.location,
 				                                    s.clock,
-				                                    regionSet.getRegionIndex(s.clock_valuation)};
+				                                    regions.getRegionIndex(s.clock_valuation)};
 			  } else {
 				  const ATAState<ConstraintSymbolType> &s = std::get<ATAState<ConstraintSymbolType>>(w);
+				  automata::ta::TimedAutomatonRegions regions{K.get_location_constant(s.location)};
 				  return ATARegionState<ConstraintSymbolType>{s.location,
-				                                              regionSet.getRegionIndex(s.clock_valuation)};
+				                                              regions.getRegionIndex(s.clock_valuation)};
 			  }
 		  });
 		abs.push_back(abs_i);
 	}
-	assert(is_valid_canonical_word(abs, 2 * K + 1));
+	assert(is_valid_canonical_word(abs, K.get_max_region_index()));
 	return abs;
 }
 
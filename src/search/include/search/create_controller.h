@@ -23,22 +23,22 @@ namespace tacos::controller_synthesis {
 
 namespace details {
 /** Construct a set of constraints from a time successor CanonicalABWord.
+ * The maximal region index of each clock is determined by the clock's maximal constant.
  */
 template <typename LocationT, typename ActionT>
 std::multimap<std::string, automata::ClockConstraint>
 get_constraints_from_time_successor(const search::CanonicalABWord<LocationT, ActionT> &word,
-                                    RegionIndex                                        max_constant,
+                                    const search::MaxConstantsParam<ActionT>          &K,
                                     automata::ta::ConstraintBoundType                  bound_type)
 {
 	using TARegionState = search::PlantRegionState<LocationT>;
 	std::multimap<std::string, automata::ClockConstraint> res;
-	const auto                                            max_region_index = 2 * max_constant + 1;
 	for (const auto &symbol : word) {
 		for (const auto &region_state : symbol) {
 			assert(std::holds_alternative<TARegionState>(region_state));
 			const TARegionState state = std::get<TARegionState>(region_state);
 			for (const auto &constraint : automata::ta::get_clock_constraints_from_region_index(
-			       state.region_index, max_region_index, bound_type)) {
+			       state.region_index, K.get_max_region_index(region_state), bound_type)) {
 				res.insert({{state.clock, constraint}});
 			}
 		}
@@ -54,7 +54,8 @@ get_constraints_from_time_successor(const search::CanonicalABWord<LocationT, Act
  * are merged into one constraint.
  * @param canonical_words The canonical words of the node.
  * @param actions The outgoing actions of the node as set of pairs (region increment, action name)
- * @param K The value of the maximal constant occurring anywhere in the input problem
+ * @param K The maximal constants of the input problem, either a single constant or the maximal
+ * constant of each clock
  * @return A multimap, where each entry is a pair (a, c), where c is a multimap of clock constraints
  * necessary when taking action a.
  */
@@ -63,7 +64,7 @@ std::multimap<ActionT, std::multimap<std::string, automata::ClockConstraint>>
 get_constraints_from_outgoing_action(
   const std::set<search::CanonicalABWord<LocationT, ConstraintSymbolT>> canonical_words,
   const std::pair<RegionIndex, ActionT> &                               timed_action,
-  RegionIndex                                                           K)
+  const search::MaxConstantsParam<ConstraintSymbolT>                   &K)
 {
 	std::map<ActionT, std::set<RegionIndex>> good_actions;
 	// TODO merging of the constraints is broken because we now get only a single action.
@@ -113,7 +114,7 @@ add_node_to_controller(
   const search::SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> *const node,
   std::set<ActionT>                                                          controller_actions,
   std::set<ActionT>                                                          environment_actions,
-  RegionIndex                                                                K,
+  const search::MaxConstantsParam<ConstraintSymbolT>                        &K,
   bool                                                                       minimize_controller,
   automata::ta::TimedAutomaton<std::set<search::CanonicalABWord<LocationT, ConstraintSymbolT>>,
                                ActionT> *                                    controller)
@@ -168,10 +169,10 @@ template <typename LocationT, typename ActionT, typename ConstraintSymbolT>
 automata::ta::TimedAutomaton<std::set<search::CanonicalABWord<LocationT, ConstraintSymbolT>>,
                              ActionT>
 create_controller(const search::SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> *const root,
-                  std::set<ActionT> controller_actions,
-                  std::set<ActionT> environment_actions,
-                  RegionIndex       K,
-                  bool              minimize_controller = true)
+                  std::set<ActionT>                                   controller_actions,
+                  std::set<ActionT>                                   environment_actions,
+                  const search::MaxConstantsParam<ConstraintSymbolT> &K,
+                  bool                                                minimize_controller = true)
 {
 	using namespace details;
 	using search::NodeLabel;
@@ -0,0 +1,297 @@
+/***************************************************************************
+ *  flat_word.h - A flat representation of canonical words
+ *
+ *  Created:   Fri 16 Oct 2026 14:25:33 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include "canonical_word.h"
+#include "symbol_table.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace tacos::search {
+
+/** @brief A canonical word flattened into contiguous arrays.
+ * Each symbol is packed into a single 64-bit code, see SymbolCodes. The codes of all partitions are
+ * stored in a single array, where the codes of each partition are sorted. The partition i consists
+ * of the codes from offsets[i] to offsets[i+1]. Additionally, each partition has a signature with
+ * one bit set for each of its codes, which allows to reject most inclusion checks without looking
+ * at the codes.
+ */
+struct FlatWord
+{
+	/** The codes of all symbols, sorted within each partition */
+	std::vector<std::uint64_t> symbols;
+	/** The start of each partition in symbols, followed by the total number of symbols */
+	std::vector<std::uint32_t> offsets{0};
+	/** For each partition, the union of the signature bits of its symbols */
+	std::vector<std::uint64_t> signatures;
+
+	/** Get the number of partitions of the word. */
+	std::size_t
+	size() const
+	{
+		return signatures.size();
+	}
+};
+
+/** Check two flat words for equality. */
+inline bool
+operator==(const FlatWord &w1, const FlatWord &w2)
+{
+	// The signatures are determined by the symbols, so they do not need to be compared.
+	return w1.offsets == w2.offsets && w1.symbols == w2.symbols;
+}
+
+/** Check two flat words for inequality. */
+inline bool
+operator!=(const FlatWord &w1, const FlatWord &w2)
+{
+	return !(w1 == w2);
+}
+
+/** Compare two flat words. This is a strict total order, but it differs from the order of the
+ * corresponding canonical words. */
+inline bool
+operator<(const FlatWord &w1, const FlatWord &w2)
+{
+	return std::tie(w1.offsets, w1.symbols) < std::tie(w2.offsets, w2.symbols);
+}
+
+namespace details {
+
+/** Mix a value into a hash. */
+inline std::uint64_t
+hash_combine(std::uint64_t hash, std::uint64_t value)
+{
+	hash = (hash ^ value) * 0x9e3779b97f4a7c15;
+	return hash ^ (hash >> 29);
+}
+
+/** Get the signature bit of a symbol code. */
+inline std::uint64_t
+signature_bit(std::uint64_t code)
+{
+	return std::uint64_t{1} << ((code * 0x9e3779b97f4a7c15) >> 58);
+}
+
+/** Check whether the sorted range [first2, last2) is included in the sorted range [first1, last1).
+ * This is equivalent to std::includes, but operates on plain arrays of codes and stops as soon as
+ * the remaining elements of the first range cannot contain the second range.
+ */
+inline bool
+includes_codes(const std::uint64_t *first1,
+               const std::uint64_t *last1,
+               const std::uint64_t *first2,
+               const std::uint64_t *last2)
+{
+	while (first2 != last2) {
+		if (last1 - first1 < last2 - first2) {
+			return false;
+		}
+		if (*first1 < *first2) {
+			++first1;
+		} else if (*first1 == *first2) {
+			++first1;
+			++first2;
+		} else {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace details
+
+/** Hash a set of flat words. Equal sets of flat words have the same hash, as long as their symbols
+ * have been flattened with the same SymbolCodes. This does not allocate any memory. */
+inline std::size_t
+hash_flat_words(const std::vector<FlatWord> &words)
+{
+	std::uint64_t hash = words.size();
+	for (const auto &word : words) {
+		for (const auto offset : word.offsets) {
+			hash = details::hash_combine(hash, offset);
+		}
+		for (const auto symbol : word.symbols) {
+			hash = details::hash_combine(hash, symbol);
+		}
+	}
+	return hash;
+}
+
+/** @brief Assign a packed 64-bit code to each symbol of a canonical word.
+ * Locations, clocks, and formulas are mapped to indexes by a SymbolTable. The symbols of the
+ * alphabet that is passed to the constructor get fixed indexes, which are looked up without a lock.
+ * The code of a plant state consists of a zero bit, 22 bits for the location index, 21 bits for the
+ * clock index, and 20 bits for the region index. The code of an ATA state consists of a one bit,
+ * 43 bits for the formula index, and 20 bits for the region index. Two symbols have the same code
+ * if and only if they are equal, so flat words can only be compared if they have been flattened by
+ * the same SymbolCodes object. All methods may be called concurrently.
+ * @tparam Location The location type of the plant
+ * @tparam ConstraintSymbolType The type of the constraint symbols of the specification
+ */
+template <typename Location, typename ConstraintSymbolType>
+class SymbolCodes
+{
+public:
+	/** The word type to flatten */
+	using Word = CanonicalABWord<Location, ConstraintSymbolType>;
+
+	/** Initialize the codes.
+	 * @param alphabet The symbols that are known in advance, looking up their codes does not take a
+	 * lock
+	 * @throws std::invalid_argument if the alphabet has too many symbols for a symbol code
+	 */
+	explicit SymbolCodes(const SymbolAlphabet<Location, ConstraintSymbolType> &alphabet = {})
+	: location_indexes_(alphabet.locations, std::uint64_t{1} << location_bits),
+	  clock_indexes_(alphabet.clocks, std::uint64_t{1} << clock_bits),
+	  formula_indexes_(alphabet.formulas, std::uint64_t{1} << formula_bits)
+	{
+	}
+
+	/** Get the code of a single symbol.
+	 * @param symbol The symbol to encode
+	 * @return The packed code of the symbol
+	 * @throws std::invalid_argument if the symbol does not fit into 64 bits
+	 */
+	std::uint64_t
+	get_code(const ABRegionSymbol<Location, ConstraintSymbolType> &symbol)
+	{
+		if (const auto *state = std::get_if<PlantRegionState<Location>>(&symbol)) {
+			const auto location = location_indexes_.get_index(state->location);
+			const auto clock    = clock_indexes_.get_index(state->clock);
+			return (location << (clock_bits + region_bits)) | (clock << region_bits)
+			       | get_region_bits(state->region_index);
+		}
+		const auto &state = std::get<ATARegionState<ConstraintSymbolType>>(symbol);
+		return (std::uint64_t{1} << 63)
+		       | (formula_indexes_.get_index(state.formula) << region_bits)
+		       | get_region_bits(state.region_index);
+	}
+
+	/** Flatten a canonical word.
+	 * @param word The word to flatten
+	 * @return The flat representation of the word
+	 */
+	FlatWord
+	flatten(const Word &word)
+	{
+		FlatWord flat_word;
+		flat_word.offsets.reserve(word.size() + 1);
+		flat_word.signatures.reserve(word.size());
+		for (const auto &partition : word) {
+			const auto    begin     = flat_word.symbols.size();
+			std::uint64_t signature = 0;
+			for (const auto &symbol : partition) {
+				const auto code = get_code(symbol);
+				flat_word.symbols.push_back(code);
+				signature |= details::signature_bit(code);
+			}
+			std::sort(std::begin(flat_word.symbols) + begin, std::end(flat_word.symbols));
+			flat_word.offsets.push_back(flat_word.symbols.size());
+			flat_word.signatures.push_back(signature);
+		}
+		return flat_word;
+	}
+
+	/** Flatten a set of canonical words, e.g., the words of a search node.
+	 * The flat words are in the same order as the words in the set. Thus, two sets of words are equal
+	 * if and only if their flat representations are equal.
+	 * @param words The words to flatten
+	 * @return The flat representation of each word
+	 */
+	std::vector<FlatWord>
+	flatten(const std::set<Word> &words)
+	{
+		std::vector<FlatWord> flat_words;
+		flat_words.reserve(words.size());
+		for (const auto &word : words) {
+			flat_words.push_back(flatten(word));
+		}
+		return flat_words;
+	}
+
+private:
+	static constexpr unsigned int region_bits   = 20;
+	static constexpr unsigned int clock_bits    = 21;
+	static constexpr unsigned int location_bits = 22;
+	static constexpr unsigned int formula_bits  = 43;
+
+	static std::uint64_t
+	get_region_bits(RegionIndex region_index)
+	{
+		if (region_index >= (std::uint64_t{1} << region_bits)) {
+			throw std::invalid_argument("Region index " + std::to_string(region_index)
+			                            + " is too large for a symbol code");
+		}
+		return region_index;
+	}
+
+	SymbolTable<Location>                                location_indexes_;
+	SymbolTable<std::string>                             clock_indexes_;
+	SymbolTable<logic::MTLFormula<ConstraintSymbolType>> formula_indexes_;
+};
+
+/**
+ * @brief Checks if the flat word w1 is monotonically dominated by the flat word w2.
+ * This is equivalent to is_monotonically_dominated on the corresponding canonical words, if both
+ * words have been flattened with the same SymbolCodes.
+ * @param w1 The word which may be dominated.
+ * @param w2 The potentially dominating word.
+ * @return true if w2 dominates w1.
+ */
+inline bool
+is_monotonically_dominated(const FlatWord &w1, const FlatWord &w2)
+{
+	std::size_t j = 0;
+	for (std::size_t i = 0; i < w1.size(); ++i) {
+		const std::uint64_t *first1 = w1.symbols.data() + w1.offsets[i];
+		const std::uint64_t *last1  = w1.symbols.data() + w1.offsets[i + 1];
+		// Find the w2 partition that includes the current w1 partition.
+		for (; j < w2.size(); ++j) {
+			if ((w1.signatures[i] & ~w2.signatures[j]) == 0
+			    && details::includes_codes(w2.symbols.data() + w2.offsets[j],
+			                               w2.symbols.data() + w2.offsets[j + 1],
+			                               first1,
+			                               last1)) {
+				break;
+			}
+		}
+		if (j == w2.size()) {
+			return false;
+		}
+		++j;
+	}
+	return true;
+}
+
+/**
+ * @brief Check the powerset order induced by monotonic domination on flat words.
+ * Checks if each word of the second set monotonically dominates a word from the first set.
+ * @param set1 First set of flat words which is to be dominated.
+ * @param set2 Second set of flat words which should dominate the first set.
+ * @return true if set1 < set2, where < is the powerset order induced by monotonic domination
+ */
+inline bool
+is_monotonically_dominated(const std::vector<FlatWord> &set1, const std::vector<FlatWord> &set2)
+{
+	return std::all_of(set2.begin(), set2.end(), [&set1](const auto &word2) {
+		return std::any_of(set1.begin(), set1.end(), [&word2](const auto &word1) {
+			return is_monotonically_dominated(word1, word2);
+		});
+	});
+}
+
+} // namespace tacos::search
@@ -12,8 +12,11 @@
 
 #include "search_tree.h"
 
+#include <algorithm>
 #include <limits>
+#include <map>
 #include <random>
+#include <variant>
 
 namespace tacos::search {
 
@@ -32,6 +35,20 @@ public:
 	 * @return The cost of the node
 	 */
 	virtual ValueT compute_cost(NodeT *node) = 0;
+	/** Check whether the cost of a node may change if the node is reached with fewer region
+	 * increments, see SearchTreeNode::min_total_region_increments. */
+	virtual bool
+	depends_on_region_increments() const
+	{
+		return false;
+	}
+	/** Check whether computing the cost of the same node twice gives the same cost. This is not the
+	 * case if the cost depends on the order of the calls, e.g., if the heuristic counts the nodes. */
+	virtual bool
+	is_deterministic() const
+	{
+		return true;
+	}
 	/** Virtual destructor. */
 	virtual ~Heuristic()
 	{
@@ -60,6 +77,13 @@ public:
 		return ++node_counter;
 	}
 
+	/** The cost depends on the order in which the nodes are evaluated. */
+	bool
+	is_deterministic() const override
+	{
+		return false;
+	}
+
 private:
 	std::atomic_size_t node_counter{0};
 };
@@ -83,6 +107,13 @@ public:
 		return -(++node_counter);
 	}
 
+	/** The cost depends on the order in which the nodes are evaluated. */
+	bool
+	is_deterministic() const override
+	{
+		return false;
+	}
+
 private:
 	std::atomic_size_t node_counter{0};
 };
@@ -105,6 +136,13 @@ public:
 	{
 		return node->min_total_region_increments;
 	}
+
+	/** The cost is the number of region increments. */
+	bool
+	depends_on_region_increments() const override
+	{
+		return true;
+	}
 };
 
 /** @brief Prefer environment actions over controller actions.
@@ -191,10 +229,108 @@ public:
 		return res;
 	}
 
+	/** Check whether any of the heuristics depends on the region increments. */
+	bool
+	depends_on_region_increments() const override
+	{
+		return std::any_of(std::begin(heuristics), std::end(heuristics), [](const auto &heuristic) {
+			return heuristic.second->depends_on_region_increments();
+		});
+	}
+
+	/** Check whether all of the heuristics are deterministic. */
+	bool
+	is_deterministic() const override
+	{
+		return std::all_of(std::begin(heuristics), std::end(heuristics), [](const auto &heuristic) {
+			return heuristic.second->is_deterministic();
+		});
+	}
+
 private:
 	std::vector<std::pair<ValueT, std::unique_ptr<Heuristic<ValueT, NodeT>>>> heuristics;
 };
 
+/** @brief Prefer nodes that are close to an accepting configuration of the plant and the ATA.
+ * The distances of the plant locations and the ATA locations to an accepting configuration are
+ * precomputed on the untimed structure of the automata, see
+ * automata::ta::TimedAutomaton::get_acceptance_distances and
+ * automata::ata::AlternatingTimedAutomaton::get_acceptance_distances. The cost of a canonical word
+ * is the maximal distance of its plant location and its ATA locations, the cost of a node is the
+ * minimal cost of its words. Thus, nodes that may soon become bad are expanded first, so their
+ * labels can be determined early.
+ * @tparam PlantLocationT The location type of the plant
+ * @tparam ATALocationT The location type of the ATA
+ */
+template <typename ValueT, typename NodeT, typename PlantLocationT, typename ATALocationT>
+class AcceptanceDistanceHeuristic : public Heuristic<ValueT, NodeT>
+{
+public:
+	/** Initialize the heuristic.
+	 * @param plant_distances The distance of each plant location to a final location
+	 * @param ata_distances The distance of each ATA location to an accepting configuration
+	 */
+	AcceptanceDistanceHeuristic(std::map<PlantLocationT, std::size_t> plant_distances,
+	                            std::map<ATALocationT, std::size_t>   ata_distances)
+	: plant_distances(std::move(plant_distances)), ata_distances(std::move(ata_distances))
+	{
+		// Locations that cannot reach an accepting configuration are more expensive than any other
+		// location.
+		for (const auto &[location, distance] : this->plant_distances) {
+			unreachable_cost = std::max(unreachable_cost, static_cast<ValueT>(distance) + 1);
+		}
+		for (const auto &[location, distance] : this->ata_distances) {
+			unreachable_cost = std::max(unreachable_cost, static_cast<ValueT>(distance) + 1);
+		}
+	}
+
+	/** Compute the cost of a node.
+	 * @param node The node to compute the cost for
+	 * @return The minimal distance of the node's words to an accepting configuration
+	 */
+	ValueT
+	compute_cost(NodeT *node) override
+	{
+		ValueT cost = unreachable_cost;
+		for (const auto &word : node->words) {
+			ValueT word_cost = 0;
+			for (const auto &component : word) {
+				for (const auto &symbol : component) {
+					word_cost = std::max(word_cost, std::visit([this](const auto &state) {
+						                     return get_distance(state);
+					                     },
+					                                          symbol));
+				}
+			}
+			cost = std::min(cost, word_cost);
+		}
+		return cost;
+	}
+
+private:
+	template <typename LocationT>
+	ValueT
+	get_distance(const PlantRegionState<LocationT> &state) const
+	{
+		const auto distance = plant_distances.find(state.location);
+		return distance == std::end(plant_distances) ? unreachable_cost
+		                                             : static_cast<ValueT>(distance->second);
+	}
+
+	template <typename ConstraintSymbolType>
+	ValueT
+	get_distance(const ATARegionState<ConstraintSymbolType> &state) const
+	{
+		const auto distance = ata_distances.find(state.formula);
+		return distance == std::end(ata_distances) ? unreachable_cost
+		                                           : static_cast<ValueT>(distance->second);
+	}
+
+	const std::map<PlantLocationT, std::size_t> plant_distances;
+	const std::map<ATALocationT, std::size_t>   ata_distances;
+	ValueT                                      unreachable_cost{0};
+};
+
 /** @brief Random heuristic that assigns random costs to nodes.
  */
 template <typename ValueT, typename NodeT>
@@ -218,6 +354,13 @@ public:
 		return dist(random_generator);
 	}
 
+	/** Each call draws a new random cost. */
+	bool
+	is_deterministic() const override
+	{
+		return false;
+	}
+
 	/** Get the seed used for the random number generator. */
 	int
 	get_seed() const
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "canonical_word.h"
+#include "flat_word.h"
 
 #include <algorithm>
 
@@ -72,6 +73,24 @@ is_monotonically_dominated(const std::set<CanonicalABWord<LocationT, ConstraintS
 	});
 }
 
+/** @brief Check the powerset order induced by monotonic domination on the words of two nodes.
+ * If both nodes have been flattened, the flat words are compared, otherwise the canonical words.
+ * @param node1 The node which is to be dominated
+ * @param node2 The node which should dominate the first node
+ * @return true if the words of node1 are monotonically dominated by the words of node2
+ */
+template <typename LocationT, typename ActionT, typename ConstraintSymbolT>
+bool
+is_monotonically_dominated(const SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> &node1,
+                           const SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> &node2)
+{
+	if (node1.flat_words.size() == node1.words.size()
+	    && node2.flat_words.size() == node2.words.size()) {
+		return is_monotonically_dominated(node1.flat_words, node2.flat_words);
+	}
+	return is_monotonically_dominated(node1.words, node2.words);
+}
+
 /** @brief Check monotonic domination for a node and its ancestors.
  *
  * Check if the given words monotonically dominate the given node or one of its ancestors. Note that
@@ -105,6 +124,36 @@ ancestor_is_monotonically_dominated(
 	return false;
 }
 
+/** @brief Check monotonic domination for a node and its ancestors.
+ * This is the same as ancestor_is_monotonically_dominated on the words of the dominating node, but
+ * it uses the flat words if they are available.
+ * @param node Check this node and its ancestors whether its words is monotonically dominated
+ * @param dominating_node The node whose words are compared against the node's words
+ * @param seen_nodes A vector of nodes that have already been seen; if the current node has already
+ * been seen, the check is aborted.
+ * @return true if the given node or one of its ancestors is monotonically dominated
+ */
+template <typename LocationT, typename ActionT, typename ConstraintSymbolT>
+bool
+ancestor_is_monotonically_dominated(
+  const SearchTreeNode<LocationT, ActionT, ConstraintSymbolT>                &node,
+  const SearchTreeNode<LocationT, ActionT, ConstraintSymbolT>                &dominating_node,
+  std::vector<const SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> *> &seen_nodes)
+{
+	if (std::find(std::begin(seen_nodes), std::end(seen_nodes), &node) != std::end(seen_nodes)) {
+		return false;
+	}
+	seen_nodes.push_back(&node);
+	return is_monotonically_dominated(node, dominating_node)
+	       || std::any_of(node.parents.begin(),
+	                      node.parents.end(),
+	                      [&dominating_node, &seen_nodes](const auto &parent) {
+		                      return ancestor_is_monotonically_dominated(*parent,
+		                                                                 dominating_node,
+		                                                                 seen_nodes);
+	                      });
+}
+
 /** Check if there is an ancestor that monotonally dominates the given node
  * @param node The node to check
  */
@@ -116,7 +165,7 @@ dominates_ancestor(SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> *node)
 	return std::any_of(node->parents.begin(),
 	                   node->parents.end(),
 	                   [node, &seen_nodes](const auto &parent) {
-		                   return ancestor_is_monotonically_dominated(*parent, node->words, seen_nodes);
+		                   return ancestor_is_monotonically_dominated(*parent, *node, seen_nodes);
 	                   });
 }
 
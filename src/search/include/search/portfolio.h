@@ -0,0 +1,64 @@
+/***************************************************************************
+ *  portfolio.h - Run several search configurations concurrently
+ *
+ *  Created:   Fri 16 Oct 2026 13:34:11 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace tacos::search {
+
+/** @brief Run several searches concurrently and stop as soon as one of them is done.
+ * Each search builds its tree in its own thread. In multi-threaded mode, each search additionally
+ * uses its own thread pool, otherwise it expands its nodes in its own thread only. The first search
+ * that completes its tree without exceeding its budget wins, all other searches are stopped
+ * immediately. The searches are independent, they do not share any nodes. To split the available
+ * CPUs, construct each search with a fraction of the available threads. Typically, the searches
+ * use different heuristics and early termination, so the search with the heuristic that suits the
+ * problem best determines the result.
+ * @param searches The searches to run, e.g., TreeSearch objects
+ * @param multi_threaded Whether each search runs its thread pool, see TreeSearch::build_tree
+ * @return The index of the search that finished first, or nullopt if every search exceeded its
+ * budget
+ */
+template <typename Search>
+std::optional<std::size_t>
+run_portfolio(const std::vector<Search *> &searches, bool multi_threaded = true)
+{
+	std::mutex                 winner_mutex;
+	std::optional<std::size_t> winner;
+	std::vector<std::thread>   threads;
+	threads.reserve(searches.size());
+	for (std::size_t i = 0; i < searches.size(); ++i) {
+		threads.emplace_back([&searches, &winner, &winner_mutex, multi_threaded, i] {
+			searches[i]->build_tree(multi_threaded);
+			std::lock_guard lock{winner_mutex};
+			if (winner || searches[i]->is_budget_exceeded()) {
+				return;
+			}
+			SPDLOG_DEBUG("Portfolio search {} finished first, stopping the others", i);
+			winner = i;
+			for (std::size_t j = 0; j < searches.size(); ++j) {
+				if (j != i) {
+					searches[j]->stop();
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	return winner;
+}
+
+} // namespace tacos::search
@@ -12,13 +12,19 @@
 #include "automata/ata.h"
 #include "automata/ta.h"
 #include "canonical_word.h"
+#include "flat_word.h"
 #include "heuristics.h"
 #include "mtl/MTLFormula.h"
 #include "mtl_ata_translation/translator.h"
 #include "operators.h"
 #include "reg_a.h"
+#include "search_budget.h"
+#include "search_progress.h"
+#include "search_statistics.h"
 #include "search_tree.h"
+#include "symbol_table.h"
 #include "synchronous_product.h"
+#include "utilities/addressable_priority_queue.h"
 #include "utilities/priority_thread_pool.h"
 #include "utilities/type_traits.h"
 #include "utilities/types.h"
@@ -27,17 +33,27 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
 #include <variant>
 
 namespace tacos::search {
 
 /** @brief Check if the node has a satisfiable ATA configuration.
  * If every word in the node contains an ATA sink location, than none of those configurations is
- * satisfiable.
+ * satisfiable. This only reads the flag that has been computed when the node was constructed.
  * @return false if every word contains an ATA sink location
  */
 template <typename Location, typename ActionType, typename ConstraintSymbolType>
@@ -45,20 +61,7 @@ bool
 has_satisfiable_ata_configuration(
   const SearchTreeNode<Location, ActionType, ConstraintSymbolType> &node)
 {
-	return !std::all_of(std::begin(node.words), std::end(node.words), [](const auto &word) {
-		return std::any_of(std::begin(word), std::end(word), [](const auto &component) {
-			return std::find_if(
-			         std::begin(component),
-			         std::end(component),
-			         [](const auto &region_symbol) {
-				         return std::holds_alternative<ATARegionState<ConstraintSymbolType>>(region_symbol)
-				                && std::get<ATARegionState<ConstraintSymbolType>>(region_symbol).formula
-				                     == logic::MTLFormula<ConstraintSymbolType>{
-				                       mtl_ata_translation::get_sink<ConstraintSymbolType>()};
-			         })
-			       != std::end(component);
-		});
-	});
+	return !node.all_words_contain_sink;
 }
 
 namespace details {
@@ -90,6 +93,10 @@ label_graph(SearchTreeNode<Location, ActionType, ConstraintSymbolType> *node,
 	} else if (node->state == NodeState::BAD) {
 		node->label_reason = LabelReason::BAD_NODE;
 		node->set_label(NodeLabel::BOTTOM);
+	} else if (!node->is_expanded) {
+		// The search was stopped before the node was expanded, we cannot say anything about it.
+		node->label_reason = LabelReason::UNEXPANDED;
+		node->set_label(NodeLabel::BOTTOM);
 	} else {
 		for (const auto &[action, child] : node->get_children()) {
 			if (child.get() != node) {
@@ -145,6 +152,80 @@ label_graph(SearchTreeNode<Location, ActionType, ConstraintSymbolType> *node,
 		}
 	}
 }
+/** Estimate the memory used by a set of canonical words, ignoring any allocator overhead. */
+template <typename Location, typename ConstraintSymbolType>
+std::size_t
+estimate_memory(const std::set<CanonicalABWord<Location, ConstraintSymbolType>> &words)
+{
+	std::size_t memory = 0;
+	for (const auto &word : words) {
+		memory += sizeof(word);
+		for (const auto &component : word) {
+			memory += sizeof(component) + component.size() * sizeof(*std::begin(component));
+		}
+	}
+	return memory;
+}
+
+/** Estimate the memory used by a set of flat words, ignoring any allocator overhead. */
+inline std::size_t
+estimate_memory(const std::vector<FlatWord> &words)
+{
+	std::size_t memory = 0;
+	for (const auto &word : words) {
+		memory += sizeof(word) + word.symbols.size() * sizeof(std::uint64_t)
+		          + word.offsets.size() * sizeof(std::uint32_t)
+		          + word.signatures.size() * sizeof(std::uint64_t);
+	}
+	return memory;
+}
+
+/** Add the locations and clocks of a timed automaton to an alphabet. */
+template <typename LocationT, typename ActionType, typename ConstraintSymbolType>
+void
+add_plant_symbols(const automata::ta::TimedAutomaton<LocationT, ActionType>               &ta,
+                  SymbolAlphabet<automata::ta::Location<LocationT>, ConstraintSymbolType> &alphabet)
+{
+	alphabet.locations = ta.get_locations();
+	alphabet.clocks    = ta.get_clocks();
+}
+
+/** The locations of other plants, e.g., of Golog programs, cannot be enumerated in advance. */
+template <typename Plant, typename Location, typename ConstraintSymbolType>
+void
+add_plant_symbols(const Plant &, SymbolAlphabet<Location, ConstraintSymbolType> &)
+{
+}
+
+/** @brief Compare sets of flat words by value, where each set may also be given by a pointer.
+ * This allows to use pointers to the flat words of the nodes as keys of a node map, while looking
+ * up nodes by the flat words themselves.
+ */
+struct FlatWordsPointerLess
+{
+	/** Allow heterogeneous lookup. */
+	using is_transparent = void;
+
+	/** Compare two sets of words given by pointers. */
+	bool
+	operator()(const std::vector<FlatWord> *words1, const std::vector<FlatWord> *words2) const
+	{
+		return *words1 < *words2;
+	}
+	/** Compare a set of words given by a pointer with a set of words. */
+	bool
+	operator()(const std::vector<FlatWord> *words1, const std::vector<FlatWord> &words2) const
+	{
+		return *words1 < words2;
+	}
+	/** Compare a set of words with a set of words given by a pointer. */
+	bool
+	operator()(const std::vector<FlatWord> &words1, const std::vector<FlatWord> *words2) const
+	{
+		return words1 < *words2;
+	}
+};
+
 } // namespace details
 
 template <typename Location, typename ActionType, typename ConstraintSymbolType>
@@ -178,16 +259,26 @@ public:
 	    std::void_t<void>>::type;
 	/** The corresponding Node type of this search. */
 	using Node = SearchTreeNode<Location, ActionType, ConstraintSymbolType>;
+	/** The adapter that computes the successors of a node. */
+	using SuccessorGenerator = get_next_canonical_words<Plant,
+	                                                    ActionType,
+	                                                    ConstraintSymbolType,
+	                                                    use_location_constraints,
+	                                                    use_set_semantics>;
 
 	/** Initialize the search.
 	 * @param ta The plant to be controlled
 	 * @param ata The specification of undesired behaviors
 	 * @param controller_actions The actions that the controller may decide to take
 	 * @param environment_actions The actions controlled by the environment
-	 * @param K The maximal constant occurring in a clock constraint
+	 * @param K The maximal constant occurring in a clock constraint, either a single constant or the
+	 * maximal constant of each plant clock and ATA location
 	 * @param incremental_labeling True, if incremental labeling should be used (default=false)
 	 * @param terminate_early If true, cancel the children of a node that has already been labeled
 	 * @param heuristic The heuristic to use during tree expansion
+	 * @param num_threads The number of threads used by build_tree in multi-threaded mode
+	 * @param affinity Whether the worker threads shall be pinned to NUMA nodes. If they are, each
+	 * NUMA node gets its own node queue, see add_node_to_queue
 	 */
 	TreeSearch(
 	  // const automata::ta::TimedAutomaton<Location, ActionType> *                                ta,
@@ -196,21 +287,27 @@ public:
 	                                           logic::AtomicProposition<ATAInputType>> *ata,
 	  std::set<ActionType>                   controller_actions,
 	  std::set<ActionType>                   environment_actions,
-	  RegionIndex                            K,
+	  MaxConstants<ConstraintSymbolType>     K,
 	  bool                                   incremental_labeling = false,
 	  bool                                   terminate_early      = false,
-	  std::unique_ptr<Heuristic<long, Node>> heuristic = std::make_unique<BfsHeuristic<long, Node>>())
+	  std::unique_ptr<Heuristic<long, Node>> heuristic = std::make_unique<BfsHeuristic<long, Node>>(),
+	  std::size_t                            num_threads = std::thread::hardware_concurrency(),
+	  utilities::ThreadPool<long>::Affinity  affinity = utilities::ThreadPool<long>::Affinity::NONE)
 	: ta_(ta),
 	  ata_(ata),
 	  controller_actions_(controller_actions),
 	  environment_actions_(environment_actions),
+	  successor_generator_(controller_actions_, environment_actions_),
 	  K_(K),
 	  incremental_labeling_(incremental_labeling),
 	  terminate_early_(terminate_early),
 	  tree_root_(std::make_shared<Node>(
 	    std::set<CanonicalABWord<typename Plant::Location, ConstraintSymbolType>>{
 	      get_canonical_word(ta->get_initial_configuration(), ata->get_initial_configuration(), K)})),
-	  nodes_{{{{}, tree_root_}}},
+	  symbol_alphabet_(get_symbol_alphabet(*ta, *ata)),
+	  symbol_codes_(symbol_alphabet_),
+	  pool_(utilities::ThreadPool<long>::StartOnInit::NO, num_threads, affinity),
+	  node_queues_(pool_.get_num_domains()),
 	  heuristic(std::move(heuristic))
 	{
 		static_assert(use_location_constraints || std::is_same_v<ActionType, ConstraintSymbolType>);
@@ -224,6 +321,10 @@ public:
 			  return controller_actions_.find(a) == controller_actions_.end();
 		  }));
 		tree_root_->min_total_region_increments = 0;
+		tree_root_->graph                       = &graph_;
+		tree_root_->flat_words                  = symbol_codes_.flatten(tree_root_->words);
+		memory_estimate_                        = estimate_node_memory(*tree_root_);
+		get_partition(root_key_).nodes.emplace(&root_key_, tree_root_);
 		add_node_to_queue(tree_root_.get());
 	}
 
@@ -245,35 +346,151 @@ public:
 	is_bad_node(Node *node) const
 	{
 		return std::any_of(node->words.begin(), node->words.end(), [this](const auto &word) {
-			const auto candidate = get_candidate(word);
-			return ta_->is_accepting_configuration(candidate.first)
-			       && ata_->is_accepting_configuration(candidate.second);
+			return is_accepting_word(*ta_, *ata_, word);
 		});
 	}
 
 	/** Add a node the processing queue. This adds a new task to the thread pool that expands the node
-	 * asynchronously.
+	 * asynchronously. If the search has already been stopped, the node is not added.
+	 * Each node is queued at most once. If the node is already in the queue, no new task is added,
+	 * but the node's priority is increased if its new cost is lower.
+	 * If the workers are pinned to NUMA nodes, the node is added to the queue of the NUMA node of the
+	 * calling worker, which also allocated the node. Workers prefer nodes from their own queue, so a
+	 * node tends to be expanded on the NUMA node that holds its memory. In this case, the priorities
+	 * are only respected within each queue, and a node that is added by two NUMA nodes at the same
+	 * time may be queued twice.
 	 * @param node The node to expand */
 	void
 	add_node_to_queue(Node *node)
 	{
-		pool_.add_job([this, node] { expand_node(node); }, -heuristic->compute_cost(node));
+		if (search_stopped_) {
+			return;
+		}
+		const long        priority = -heuristic->compute_cost(node);
+		const std::size_t domain   = pool_.get_current_domain();
+		for (std::size_t other_domain = 0; other_domain < node_queues_.size(); ++other_domain) {
+			if (other_domain == domain) {
+				continue;
+			}
+			std::lock_guard lock{node_queues_[other_domain].mutex};
+			if (node_queues_[other_domain].nodes.increase_priority(node, priority)) {
+				return;
+			}
+		}
+		{
+			std::lock_guard lock{node_queues_[domain].mutex};
+			if (!node_queues_[domain].nodes.push(node, priority)) {
+				return;
+			}
+		}
+		// Each task expands the node with the highest priority, so the task's own priority does not
+		// matter.
+		pool_.add_job([this] { expand_next_node(); });
 	}
 
 	/** Build the complete search tree by expanding nodes recursively.
+	 * If a progress reporter is set, it is called periodically during the search and once after the
+	 * search has completed.
 	 * @param multi_threaded If set to true, run the thread pool. Otherwise, process the jobs
 	 * synchronously with a single thread. */
 	void
 	build_tree(bool multi_threaded = true)
 	{
+		start_time_ = std::chrono::steady_clock::now();
 		if (multi_threaded) {
+			std::thread             reporter;
+			std::mutex              reporter_mutex;
+			std::condition_variable reporter_cond;
+			bool                    done{false};
+			if (progress_callback_) {
+				reporter = std::thread{[&]() {
+					std::unique_lock lock{reporter_mutex};
+					while (!reporter_cond.wait_for(lock, progress_interval_, [&done] { return done; })) {
+						progress_callback_(get_progress());
+					}
+				}};
+			}
 			pool_.start();
 			pool_.wait();
+			if (reporter.joinable()) {
+				{
+					std::lock_guard lock{reporter_mutex};
+					done = true;
+				}
+				reporter_cond.notify_all();
+				reporter.join();
+			}
 		} else {
-			while (step()) {}
+			auto last_report = start_time_;
+			while (step()) {
+				if (progress_callback_
+				    && std::chrono::steady_clock::now() - last_report >= progress_interval_) {
+					progress_callback_(get_progress());
+					last_report = std::chrono::steady_clock::now();
+				}
+			}
+		}
+		if (progress_callback_) {
+			progress_callback_(get_progress());
 		}
 	}
 
+	/** Report the progress of the search periodically while the tree is built.
+	 * In multi-threaded mode, the callback is called from a separate thread.
+	 * @param callback The function to call with the current progress, e.g., log_progress
+	 * @param interval The time between two reports
+	 */
+	void
+	set_progress_reporter(ProgressCallback          callback,
+	                      std::chrono::milliseconds interval = std::chrono::seconds{1})
+	{
+		progress_callback_ = std::move(callback);
+		progress_interval_ = interval;
+	}
+
+	/** Get a snapshot of the current state of the search.
+	 * This may be called while the search is running. It only reads counters that are updated
+	 * atomically during the search, so it does not block the worker threads.
+	 * @return The current progress of the search
+	 */
+	SearchProgress
+	get_progress()
+	{
+		SearchProgress progress;
+		progress.elapsed        = std::chrono::steady_clock::now() - start_time_;
+		progress.queue_size     = get_queue_size();
+		progress.expanded_nodes = num_expanded_nodes_;
+		if (progress.elapsed.count() > 0) {
+			progress.nodes_per_second = progress.expanded_nodes / progress.elapsed.count();
+		}
+		progress.root_label      = tree_root_->label;
+		progress.memory_estimate = memory_estimate_;
+		progress.nodes           = num_nodes_;
+		progress.labeled_nodes   = graph_.labeled_nodes;
+		return progress;
+	}
+
+	/** Limit the resources of the search.
+	 * Once the budget is exceeded, no more nodes are expanded. Unexpanded nodes are labeled as bad
+	 * during labeling, so if the root is labeled with TOP, the controller is still valid. Otherwise,
+	 * the result is unknown.
+	 * @param budget The budget of the search
+	 */
+	void
+	set_budget(const SearchBudget &budget)
+	{
+		budget_ = budget;
+	}
+
+	/** Check whether the search has been stopped because the budget was exceeded.
+	 * @return true if the search budget was exceeded
+	 */
+	bool
+	is_budget_exceeded() const
+	{
+		return budget_exceeded_;
+	}
+
 	/** Compute the next iteration by taking the first item of the queue and expanding it.
 	 * @return true if there was still an unexpanded node
 	 */
@@ -291,12 +508,58 @@ public:
 		return true;
 	}
 
+	/** Reset a canceled node that is needed again, together with its canceled descendants.
+	 * Descendants that are not expanded yet are queued for expansion. As a canceled descendant
+	 * may be missing the label of one of its canceled children, the labels of the reactivated
+	 * expanded nodes are propagated again, starting with the deepest node.
+	 * @param node The canceled node to reactivate
+	 * @param statistics The statistics of the calling thread
+	 */
+	void
+	reactivate(Node *node, SearchStatistics &statistics)
+	{
+		std::vector<Node *> pending{node};
+		std::vector<Node *> expanded;
+		while (!pending.empty()) {
+			Node *current = pending.back();
+			pending.pop_back();
+			if (current->label != NodeLabel::CANCELED) {
+				continue;
+			}
+			current->reset_label();
+			++statistics.requeues;
+			if (!current->is_expanded) {
+				add_node_to_queue(current);
+				continue;
+			}
+			expanded.push_back(current);
+			for (const auto &[action, child] : current->get_children()) {
+				pending.push_back(child.get());
+			}
+		}
+		if (incremental_labeling_) {
+			for (auto it = std::rbegin(expanded); it != std::rend(expanded); ++it) {
+				(*it)->label_propagate(controller_actions_, environment_actions_, terminate_early_);
+			}
+		}
+	}
+
 	/** Process and expand the given node.  */
 	void
 	expand_node(Node *node)
 	{
 		if (node->label != NodeLabel::UNLABELED) {
 			// The node was already labeled, nothing to do.
+			if (node->label == NodeLabel::CANCELED) {
+				++local_statistics().cancellations;
+			}
+			return;
+		}
+		if (exceeds_budget()) {
+			return;
+		}
+		if (node->is_expanded) {
+			// The node was queued more than once and has already been expanded.
 			return;
 		}
 		bool is_expanding = node->is_expanding.exchange(true);
@@ -304,9 +567,22 @@ public:
 			// The node is already being expanded.
 			return;
 		}
+		if (node->is_expanded) {
+			// Another thread finished expanding the node after the check above.
+			node->is_expanding = false;
+			return;
+		}
 		SPDLOG_TRACE("Processing {}", *node);
-		if (is_bad_node(node)) {
+		SearchStatistics &statistics = local_statistics();
+		++statistics.expanded_nodes;
+		++num_expanded_nodes_;
+		const bool is_bad = [&]() {
+			ScopedTimer timer{&statistics.is_bad_node_time};
+			return is_bad_node(node);
+		}();
+		if (is_bad) {
 			SPDLOG_DEBUG("Node {} is BAD", *node);
+			++statistics.bad_nodes;
 			node->label_reason = LabelReason::BAD_NODE;
 			node->state        = NodeState::BAD;
 			node->is_expanded  = true;
@@ -317,7 +593,21 @@ public:
 			}
 			return;
 		}
+		if (!may_become_bad(node)) {
+			SPDLOG_DEBUG("Node {} cannot reach a bad configuration", *node);
+			++statistics.backward_prunes;
+			node->label_reason = LabelReason::BAD_CONFIGURATION_UNREACHABLE;
+			node->state        = NodeState::GOOD;
+			node->is_expanded  = true;
+			node->is_expanding = false;
+			if (incremental_labeling_) {
+				node->set_label(NodeLabel::TOP, terminate_early_);
+				node->label_propagate(controller_actions_, environment_actions_, terminate_early_);
+			}
+			return;
+		}
 		if (!has_satisfiable_ata_configuration(*node)) {
+			++statistics.good_nodes;
 			node->label_reason = LabelReason::NO_ATA_SUCCESSOR;
 			node->state        = NodeState::GOOD;
 			node->is_expanded  = true;
@@ -328,7 +618,12 @@ public:
 			}
 			return;
 		}
-		if (dominates_ancestor(node)) {
+		const bool dominates = [&]() {
+			ScopedTimer timer{&statistics.dominates_ancestor_time};
+			return dominates_ancestor(node);
+		}();
+		if (dominates) {
+			++statistics.domination_prunes;
 			node->label_reason = LabelReason::MONOTONIC_DOMINATION;
 			node->state        = NodeState::GOOD;
 			node->is_expanded  = true;
@@ -342,14 +637,24 @@ public:
 
 		std::set<Node *> new_children;
 		std::set<Node *> existing_children;
+		std::set<Node *> improved_children;
+		const RegionIndex increments = node->min_total_region_increments;
 		if (node->get_children().empty()) {
-			std::tie(new_children, existing_children) = compute_children(node);
+			std::tie(new_children, existing_children, improved_children) = compute_children(node);
 		}
 
 		node->is_expanded  = true;
 		node->is_expanding = false;
+		if (node->min_total_region_increments != increments) {
+			// The node has been reached faster while its children were added, which did not update the
+			// children, see update_min_total_region_increments.
+			for (auto *child : node->update_children_min_total_region_increments()) {
+				improved_children.insert(child);
+			}
+		}
 		if (node->label == NodeLabel::CANCELED) {
 			// The node has been canceled in the meantime, do not add children to queue.
+			++statistics.cancellations;
 			return;
 		}
 		for (const auto &child : existing_children) {
@@ -358,8 +663,20 @@ public:
 				SPDLOG_DEBUG("Expansion of {}: Found existing child {}, is canceled, re-adding",
 				             fmt::ptr(node),
 				             fmt::ptr(child));
-				child->reset_label();
-				add_node_to_queue(child);
+				reactivate(child, statistics);
+			}
+		}
+		// Only recompute the priority if it may have changed. Otherwise, e.g., a BFS would demote each
+		// improved child, so the queued priority is kept.
+		if (heuristic->depends_on_region_increments() && heuristic->is_deterministic()) {
+			for (const auto &child : improved_children) {
+				// The node can be reached faster through the expanded node, update its priority if it is
+				// queued.
+				const long priority = -heuristic->compute_cost(child);
+				for (auto &queue : node_queues_) {
+					std::lock_guard lock{queue.mutex};
+					queue.nodes.increase_priority(child, priority);
+				}
 			}
 		}
 		if (incremental_labeling_ && !existing_children.empty()) {
@@ -374,6 +691,7 @@ public:
 		             node->get_children().size(),
 		             new_children.size());
 		if (node->get_children().empty()) {
+			++statistics.dead_nodes;
 			node->label_reason = LabelReason::DEAD_NODE;
 			node->state        = NodeState::DEAD;
 			if (incremental_labeling_) {
@@ -401,19 +719,246 @@ public:
 	size_t
 	get_size() const
 	{
-		std::lock_guard lock{nodes_mutex_};
-		return nodes_.size();
+		return num_nodes_;
+	}
+
+	/** Get the successor generator that computes the children of a node.
+	 * This allows to configure the generator before the search is started, e.g., to provide
+	 * precomputed information about the plant.
+	 * @return A reference to the successor generator
+	 */
+	SuccessorGenerator &
+	get_successor_generator()
+	{
+		return successor_generator_;
+	}
+
+	/** Get the statistics collected during the search.
+	 * The statistics of all threads are merged. As the worker threads update their statistics
+	 * without synchronization, this should only be called when no node is being expanded, e.g., after
+	 * the tree has been built.
+	 * @return The merged statistics of all threads
+	 */
+	SearchStatistics
+	get_statistics() const
+	{
+		std::lock_guard  lock{statistics_mutex_};
+		SearchStatistics statistics;
+		for (const auto &[thread, thread_statistics] : thread_statistics_) {
+			statistics += thread_statistics;
+		}
+		return statistics;
+	}
+
+	/** Get the current search nodes.
+	 * This collects the nodes of all partitions, so it should not be called frequently.
+	 * @return All nodes of the search graph, in no particular order
+	 */
+	std::vector<std::shared_ptr<Node>>
+	get_nodes() const
+	{
+		std::vector<std::shared_ptr<Node>> nodes;
+		nodes.reserve(num_nodes_);
+		for (auto &partition : node_partitions_) {
+			std::lock_guard lock{partition.mutex};
+			for (const auto &[words, node] : partition.nodes) {
+				nodes.push_back(node);
+			}
+		}
+		return nodes;
+	}
+
+	/** @brief Prune all nodes that can never reach a bad configuration.
+	 * This runs a backward analysis on the untimed structure of the plant and the ATA as a pre-pass,
+	 * see automata::ta::TimedAutomaton::get_acceptance_distances and
+	 * automata::ata::AlternatingTimedAutomaton::get_acceptance_distances. A word can only become bad
+	 * if its plant location can reach a final location and each of its ATA locations can reach an
+	 * accepting configuration. If this is not the case for any word of a node, the node is labeled
+	 * as good without expanding it. The analysis ignores all clock constraints, so it never prunes a
+	 * node that may become bad. The same distances can be used to rank the nodes with the
+	 * AcceptanceDistanceHeuristic. This must be called before the search is started.
+	 */
+	void
+	enable_backward_pruning()
+	{
+		enable_backward_pruning(ta_->get_acceptance_distances(), ata_->get_acceptance_distances());
+	}
+
+	/** @brief Prune all nodes that can never reach a bad configuration, using precomputed distances.
+	 * This avoids running the backward analysis again, e.g., if the distances are also used by the
+	 * heuristic or by several searches.
+	 * @param plant_distances The result of TimedAutomaton::get_acceptance_distances of the plant
+	 * @param ata_distances The result of AlternatingTimedAutomaton::get_acceptance_distances
+	 * @see enable_backward_pruning()
+	 */
+	void
+	enable_backward_pruning(
+	  std::map<Location, std::size_t>                                 plant_distances,
+	  std::map<logic::MTLFormula<ConstraintSymbolType>, std::size_t> ata_distances)
+	{
+		acceptance_distances_.emplace(std::move(plant_distances), std::move(ata_distances));
 	}
 
-	/** Get the current search nodes. */
-	const std::map<std::set<CanonicalABWord<Location, ConstraintSymbolType>>, std::shared_ptr<Node>> &
-	get_nodes()
+	/** Stop the search and discard all queued nodes.
+	 * This may be called from another thread while the tree is being built, e.g., if another search
+	 * has already determined the result. The search tree remains incomplete.
+	 * @see run_portfolio
+	 */
+	void
+	stop()
 	{
-		return nodes_;
+		stop_search();
 	}
 
 private:
-	std::pair<std::set<Node *>, std::set<Node *>>
+	/** Check whether the search budget is exceeded and remember if it is. */
+	bool
+	exceeds_budget()
+	{
+		if (budget_exceeded_) {
+			return true;
+		}
+		const bool exceeded =
+		  (budget_.time && std::chrono::steady_clock::now() - start_time_ > *budget_.time)
+		  || (budget_.nodes && num_nodes_ > *budget_.nodes)
+		  || (budget_.memory && memory_estimate_ > *budget_.memory);
+		if (exceeded && !budget_exceeded_.exchange(true)) {
+			SPDLOG_WARN("Search budget exceeded after {} nodes, stopping the search",
+			            num_nodes_.load());
+			stop_search();
+		}
+		return exceeded;
+	}
+
+	/** Stop the search by discarding all queued jobs at once.
+	 * Jobs that are currently running finish normally, but no new jobs are added afterwards. */
+	void
+	stop_search()
+	{
+		if (search_stopped_.exchange(true)) {
+			return;
+		}
+		pool_.clear_queue();
+		std::size_t discarded_jobs = 0;
+		for (auto &queue : node_queues_) {
+			std::lock_guard lock{queue.mutex};
+			discarded_jobs += queue.nodes.size();
+			queue.nodes.clear();
+		}
+		local_statistics().discarded_jobs += discarded_jobs;
+		SPDLOG_DEBUG("Stopping the search, discarded {} queued jobs", discarded_jobs);
+	}
+
+	/** Expand the queued node with the highest priority and stop the search if the root has been
+	 * labeled and early termination is enabled. The node is taken from the queue of the calling
+	 * worker's NUMA node. Only if that queue is empty, a node is taken from another queue. */
+	void
+	expand_next_node()
+	{
+		Node             *node   = nullptr;
+		const std::size_t domain = pool_.get_current_domain();
+		for (std::size_t i = 0; i < node_queues_.size() && node == nullptr; ++i) {
+			auto           &queue = node_queues_[(domain + i) % node_queues_.size()];
+			std::lock_guard lock{queue.mutex};
+			if (!queue.nodes.empty()) {
+				node = queue.nodes.top().second;
+				queue.nodes.pop();
+			}
+		}
+		if (node == nullptr) {
+			// The queues have been cleared in the meantime.
+			return;
+		}
+		expand_node(node);
+		if (terminate_early_
+		    && (tree_root_->label == NodeLabel::TOP || tree_root_->label == NodeLabel::BOTTOM)) {
+			stop_search();
+		}
+	}
+
+	/** Check whether the backward analysis allows a word of the node to become bad.
+	 * @return false if backward pruning is enabled and no word can reach a bad configuration */
+	bool
+	may_become_bad(const Node *node) const
+	{
+		if (!acceptance_distances_) {
+			return true;
+		}
+		const auto &[plant_distances, ata_distances] = *acceptance_distances_;
+		return std::any_of(node->words.begin(), node->words.end(), [&](const auto &word) {
+			for (const auto &component : word) {
+				for (const auto &symbol : component) {
+					if (const auto *state = std::get_if<PlantRegionState<Location>>(&symbol)) {
+						if (plant_distances.count(state->location) == 0) {
+							return false;
+						}
+					} else if (ata_distances.count(
+					             std::get<ATARegionState<ConstraintSymbolType>>(symbol).formula)
+					           == 0) {
+						return false;
+					}
+				}
+			}
+			return true;
+		});
+	}
+
+	/** Get the number of nodes waiting in the queue. */
+	std::size_t
+	get_queue_size()
+	{
+		std::size_t size = 0;
+		for (auto &queue : node_queues_) {
+			std::lock_guard lock{queue.mutex};
+			size += queue.nodes.size();
+		}
+		return size;
+	}
+
+	/** Collect the symbols that are known to occur in the words of the search.
+	 * These are the locations of the ATA and, if the plant is a timed automaton, its locations and
+	 * clocks. The codes of these symbols are assigned in advance, so flattening words only needs a
+	 * lock for symbols of plants whose locations cannot be enumerated.
+	 */
+	template <typename ATA>
+	static SymbolAlphabet<Location, ConstraintSymbolType>
+	get_symbol_alphabet(const Plant &plant, const ATA &ata)
+	{
+		SymbolAlphabet<Location, ConstraintSymbolType> alphabet;
+		details::add_plant_symbols(plant, alphabet);
+		alphabet.formulas = ata.get_locations();
+		return alphabet;
+	}
+
+	/** Estimate the memory needed to store the given node. */
+	static std::size_t
+	estimate_node_memory(const Node &node)
+	{
+		// The node map only refers to the words stored in the node itself.
+		return sizeof(Node) + sizeof(void *) + details::estimate_memory(node.words)
+		       + details::estimate_memory(node.flat_words);
+	}
+
+	/** Get the statistics of the calling thread.
+	 * The statistics are cached in a thread-local variable so the lock is only acquired on the first
+	 * access of each thread.
+	 */
+	SearchStatistics &
+	local_statistics()
+	{
+		thread_local std::pair<std::size_t, SearchStatistics *> cache{0, nullptr};
+		if (cache.first != instance_id_) {
+			std::lock_guard lock{statistics_mutex_};
+			cache = {instance_id_, &thread_statistics_[std::this_thread::get_id()]};
+		}
+		return *cache.second;
+	}
+
+	/** Compute the children of a node and add them to the search graph.
+	 * @return The new children, the existing children, and the existing nodes whose minimal total
+	 * region increments improved because of the node, including the descendants of the children
+	 */
+	std::tuple<std::set<Node *>, std::set<Node *>, std::set<Node *>>
 	compute_children(Node *node)
 	{
 		if (node == nullptr) {
@@ -424,49 +969,68 @@ private:
 		         std::set<CanonicalABWord<Location, ConstraintSymbolType>>>
 		  child_classes;
 
-		const auto time_successors = get_time_successors(node->words, K_);
+		SearchStatistics &statistics      = local_statistics();
+		const auto        time_successors = [&]() {
+			ScopedTimer timer{&statistics.time_successors_time};
+			return get_time_successors(node->words, K_);
+		}();
 		for (std::size_t increment = 0; increment < time_successors.size(); ++increment) {
 			for (const auto &time_successor : time_successors[increment]) {
-				auto successors =
-				  get_next_canonical_words<Plant,
-				                           ActionType,
-				                           ConstraintSymbolType,
-				                           use_location_constraints,
-				                           use_set_semantics>(controller_actions_, environment_actions_)(
-				    *ta_, *ata_, get_candidate(time_successor), increment, K_);
-				for (const auto &[symbol, successor] : successors) {
+				auto successors = successor_generator_(
+				  *ta_, *ata_, get_candidate(time_successor), increment, K_, &statistics);
+				for (auto &[symbol, successor] : successors) {
 					assert(
 					  std::find(std::begin(controller_actions_), std::end(controller_actions_), symbol)
 					    != std::end(controller_actions_)
 					  || std::find(std::begin(environment_actions_), std::end(environment_actions_), symbol)
 					       != std::end(environment_actions_));
-					child_classes[std::make_pair(increment, symbol)].insert(successor);
+					child_classes[std::make_pair(increment, symbol)].insert(std::move(successor));
 				}
 			}
 		}
 
 		std::set<Node *> new_children;
 		std::set<Node *> existing_children;
+		std::set<Node *> improved_children;
 		// Create child nodes, where each child contains all successors words of
 		// the same reg_a class.
 		{
-			std::lock_guard lock{nodes_mutex_};
-			for (const auto &[timed_action, words] : child_classes) {
-				auto [child_it, is_new] = nodes_.insert({words, std::make_shared<Node>(words)});
-				const std::shared_ptr<Node> &child_ptr = child_it->second;
-				node->add_child(timed_action, child_ptr);
+			ScopedTimer timer{&statistics.nodes_insert_time};
+			std::vector<std::pair<std::pair<RegionIndex, ActionType>, std::shared_ptr<Node>>> children;
+			for (auto &[timed_action, words] : child_classes) {
+				// Only the partition that owns the words is locked, so other threads can insert nodes
+				// into the other partitions at the same time.
+				auto            flat_words = symbol_codes_.flatten(words);
+				NodePartition  &partition  = get_partition(flat_words);
+				std::lock_guard lock{partition.mutex};
+				if (auto child_it = partition.nodes.find(flat_words);
+				    child_it != std::end(partition.nodes)) {
+					children.emplace_back(timed_action, child_it->second);
+					existing_children.insert(child_it->second.get());
+					continue;
+				}
+				// The words are moved into the node, the node map only refers to them.
+				auto child                   = std::make_shared<Node>(std::move(words));
+				child->flat_words            = std::move(flat_words);
+				child->graph                 = &graph_;
+				partition.nodes.emplace(&child->flat_words, child);
+				++num_nodes_;
+				memory_estimate_ += estimate_node_memory(*child);
+				new_children.insert(child.get());
+				children.emplace_back(timed_action, std::move(child));
+			}
+			for (const auto &[timed_action, child] : children) {
 				SPDLOG_TRACE("Action ({}, {}): Adding child {}",
 				             timed_action.first,
 				             timed_action.second,
-				             words);
-				if (is_new) {
-					new_children.insert(child_ptr.get());
-				} else {
-					existing_children.insert(child_ptr.get());
+				             child->words);
+				const auto improved_nodes = node->add_child(timed_action, child);
+				if (existing_children.count(child.get()) > 0) {
+					improved_children.insert(std::begin(improved_nodes), std::end(improved_nodes));
 				}
 			}
 		}
-		return {new_children, existing_children};
+		return {new_children, existing_children, improved_children};
 	}
 
 	const Plant *const ta_;
@@ -474,18 +1038,81 @@ private:
 	                                               logic::AtomicProposition<ATAInputType>>
 	  *const ata_;
 
-	const std::set<ActionType> controller_actions_;
-	const std::set<ActionType> environment_actions_;
-	RegionIndex                K_;
-	const bool                 incremental_labeling_;
-	const bool                 terminate_early_{false};
+	const std::set<ActionType>               controller_actions_;
+	const std::set<ActionType>               environment_actions_;
+	SuccessorGenerator                       successor_generator_;
+	const MaxConstants<ConstraintSymbolType> K_;
+	const bool                               incremental_labeling_;
+	const bool                               terminate_early_{false};
+
+	/** @brief A part of the search graph's nodes, protected by its own lock.
+	 * Each set of words is owned by exactly one partition, determined by its hash. All partitions
+	 * live in the memory of this process; they only reduce the contention between workers that
+	 * insert or look up nodes at the same time. The nodes are
+	 * indexed by a pointer to their own flat words, so the words are not stored twice and comparing
+	 * two keys only compares arrays of symbol codes. */
+	struct NodePartition
+	{
+		std::mutex mutex;
+		std::map<const std::vector<FlatWord> *, std::shared_ptr<Node>, details::FlatWordsPointerLess>
+		  nodes;
+	};
+
+	/** Get the partition that owns the given flat words.
+	 * The owner is determined by the hash of the flat words, which does not allocate. As the symbols
+	 * of the plant and the ATA get their codes by their rank, the owner of a set of words does not
+	 * depend on the order in which the nodes are created.
+	 */
+	NodePartition &
+	get_partition(const std::vector<FlatWord> &flat_words)
+	{
+		return node_partitions_[hash_flat_words(flat_words) % node_partitions_.size()];
+	}
 
-	mutable std::mutex    nodes_mutex_;
 	std::shared_ptr<Node> tree_root_;
-	std::map<std::set<CanonicalABWord<Location, ConstraintSymbolType>>, std::shared_ptr<Node>> nodes_;
-	utilities::ThreadPool<long> pool_{utilities::ThreadPool<long>::StartOnInit::NO};
+	/** The root is indexed by an empty set of words rather than by its own words. */
+	const std::vector<FlatWord> root_key_;
+	/** The symbols of the plant and the ATA, which are known before the search starts. */
+	const SymbolAlphabet<Location, ConstraintSymbolType> symbol_alphabet_;
+	/** The codes of the symbols of all flattened words of this search, pre-assigned for the symbols
+	 * of the plant and the ATA. */
+	SymbolCodes<Location, ConstraintSymbolType> symbol_codes_;
+	/** The nodes of the search graph, partitioned by the hash of their words. */
+	mutable std::array<NodePartition, 64> node_partitions_;
+	/** Protects the edges of the search graph and counts the labeled nodes. */
+	SearchGraphContext graph_;
+	utilities::ThreadPool<long> pool_;
+	/** The nodes waiting for expansion, with the negated heuristic cost as priority. */
+	struct NodeQueue
+	{
+		std::mutex                                        mutex;
+		utilities::AddressablePriorityQueue<Node *, long> nodes;
+	};
+	/** One node queue for each domain of the thread pool, i.e., for each NUMA node. */
+	std::vector<NodeQueue> node_queues_;
 	std::unique_ptr<Heuristic<long, SearchTreeNode<Location, ActionType, ConstraintSymbolType>>>
 	  heuristic;
+
+	/** A unique ID of this search, used to identify the thread-local statistics cache. */
+	static inline std::atomic_size_t instance_counter_{0};
+	const std::size_t                instance_id_{++instance_counter_};
+	mutable std::mutex               statistics_mutex_;
+	std::map<std::thread::id, SearchStatistics> thread_statistics_;
+	/** The number of expanded nodes, updated immediately so it can be read during the search. */
+	std::atomic_size_t                    num_expanded_nodes_{0};
+	/** The number of nodes and their estimated memory, updated without locking the node map. */
+	std::atomic_size_t                    num_nodes_{1};
+	std::atomic_size_t                    memory_estimate_{0};
+	SearchBudget                          budget_;
+	std::atomic_bool                      budget_exceeded_{false};
+	std::atomic_bool                      search_stopped_{false};
+	std::chrono::steady_clock::time_point start_time_{std::chrono::steady_clock::now()};
+	ProgressCallback                      progress_callback_;
+	/** The distances of the plant and ATA locations to acceptance, set if backward pruning is on. */
+	std::optional<std::pair<std::map<Location, std::size_t>,
+	                        std::map<logic::MTLFormula<ConstraintSymbolType>, std::size_t>>>
+	  acceptance_distances_;
+	std::chrono::milliseconds             progress_interval_{std::chrono::seconds{1}};
 };
 
 } // namespace tacos::search
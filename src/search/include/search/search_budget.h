@@ -0,0 +1,31 @@
+/***************************************************************************
+ *  search_budget.h - Resource limits for the tree search
+ *
+ *  Created:   Fri 16 Oct 2026 13:10:16 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+namespace tacos::search {
+
+/** @brief The resources that a search may use.
+ * Each limit is optional, an empty limit means that the resource is not limited.
+ * @see TreeSearch::set_budget
+ */
+struct SearchBudget
+{
+	/** The maximal wall-clock time since the start of the search. */
+	std::optional<std::chrono::milliseconds> time;
+	/** The maximal number of nodes in the search graph. */
+	std::optional<std::size_t> nodes;
+	/** The maximal estimated memory of the search graph in bytes. */
+	std::optional<std::size_t> memory;
+};
+
+} // namespace tacos::search
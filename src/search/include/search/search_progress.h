@@ -0,0 +1,79 @@
+/***************************************************************************
+ *  search_progress.h - Report the progress of a running search
+ *
+ *  Created:   Fri 16 Oct 2026 13:04:31 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include "search_tree.h"
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace tacos::search {
+
+/** @brief A snapshot of the state of a running search.
+ * @see TreeSearch::get_progress
+ */
+struct SearchProgress
+{
+	/** The time since the search has been started. */
+	std::chrono::duration<double> elapsed{0};
+	/** The number of jobs waiting in the queue. */
+	std::size_t queue_size{0};
+	/** The number of nodes in the search graph. */
+	std::size_t nodes{0};
+	/** The number of nodes that have been expanded. */
+	std::size_t expanded_nodes{0};
+	/** The number of nodes that have been labeled, not including canceled nodes. */
+	std::size_t labeled_nodes{0};
+	/** The average number of expanded nodes per second since the start of the search. */
+	double nodes_per_second{0};
+	/** A rough estimate of the memory used by the search graph in bytes. */
+	std::size_t memory_estimate{0};
+	/** The current label of the root node. */
+	NodeLabel root_label{NodeLabel::UNLABELED};
+};
+
+/** A function that is called with the current progress of the search. */
+using ProgressCallback = std::function<void(const SearchProgress &)>;
+
+/** Print the search progress on a single line. */
+std::ostream &operator<<(std::ostream &os, const SearchProgress &progress);
+
+/** Convert the search progress into a single-line JSON object. */
+std::string to_json(const SearchProgress &progress);
+
+/** Report the search progress to the logger. */
+void log_progress(const SearchProgress &progress);
+
+/** @brief Write the search progress to a file.
+ * Each report is appended as a single JSON object on its own line. Copies of the writer share the
+ * same file, so the same writer can be used by several concurrent searches. */
+class JsonProgressWriter
+{
+public:
+	/** Open the file to write to. Any existing content is overwritten.
+	 * @param path The path of the output file
+	 */
+	explicit JsonProgressWriter(const std::filesystem::path &path);
+	/** Append the given progress to the file. */
+	void operator()(const SearchProgress &progress);
+
+private:
+	// Shared so the writer can be copied into a ProgressCallback.
+	std::shared_ptr<std::ofstream> stream_;
+	std::shared_ptr<std::mutex>    mutex_;
+};
+
+} // namespace tacos::search
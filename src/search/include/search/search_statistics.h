@@ -0,0 +1,95 @@
+/***************************************************************************
+ *  search_statistics.h - Statistics collected during the tree search
+ *
+ *  Created:   Fri 16 Oct 2026 12:57:43 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+namespace tacos::search {
+
+/** @brief Counters and timers collected during the search.
+ * Each worker thread collects its own statistics, they are merged when they are requested.
+ * @see TreeSearch::get_statistics
+ */
+struct SearchStatistics
+{
+	/** The number of nodes that have been processed. */
+	std::size_t expanded_nodes{0};
+	/** The number of nodes that violate the specification. */
+	std::size_t bad_nodes{0};
+	/** The number of nodes without satisfiable ATA configuration. */
+	std::size_t good_nodes{0};
+	/** The number of nodes without successors. */
+	std::size_t dead_nodes{0};
+	/** The number of nodes that were not expanded because they dominate an ancestor. */
+	std::size_t domination_prunes{0};
+	/** The number of nodes that were not expanded because they cannot reach a bad configuration. */
+	std::size_t backward_prunes{0};
+	/** The number of jobs that were skipped because the node had been canceled. */
+	std::size_t cancellations{0};
+	/** The number of canceled nodes that were added to the queue again. */
+	std::size_t requeues{0};
+	/** The number of queued jobs that were discarded because the search was stopped. */
+	std::size_t discarded_jobs{0};
+	/** The number of plant configurations whose enabled transitions were found in the cache. */
+	std::size_t successor_cache_hits{0};
+	/** The number of plant configurations whose enabled transitions were not found in the cache. */
+	std::size_t successor_cache_misses{0};
+	/** The time spent checking whether a node is bad. */
+	std::chrono::nanoseconds is_bad_node_time{0};
+	/** The time spent checking whether a node dominates one of its ancestors. */
+	std::chrono::nanoseconds dominates_ancestor_time{0};
+	/** The time spent computing the time successors of a node. */
+	std::chrono::nanoseconds time_successors_time{0};
+	/** The time spent in symbol steps of the ATA. */
+	std::chrono::nanoseconds ata_step_time{0};
+	/** The time spent in symbol steps of the plant. */
+	std::chrono::nanoseconds plant_step_time{0};
+	/** The time spent inserting new nodes into the search graph, including waiting for the lock. */
+	std::chrono::nanoseconds nodes_insert_time{0};
+
+	/** Add the statistics of another thread to these statistics. */
+	SearchStatistics &operator+=(const SearchStatistics &other);
+};
+
+/** @brief Measure the lifetime of the timer and add it to the given duration.
+ * If the given duration is a nullptr, nothing is measured.
+ */
+class ScopedTimer
+{
+public:
+	/** Start the timer.
+	 * @param duration The duration to add the elapsed time to, may be a nullptr
+	 */
+	explicit ScopedTimer(std::chrono::nanoseconds *duration)
+	: duration_(duration),
+	  start_(duration_ == nullptr ? std::chrono::steady_clock::time_point{}
+	                              : std::chrono::steady_clock::now())
+	{
+	}
+	ScopedTimer(const ScopedTimer &)            = delete;
+	ScopedTimer &operator=(const ScopedTimer &) = delete;
+	/** Stop the timer and add the elapsed time to the duration. */
+	~ScopedTimer()
+	{
+		if (duration_ != nullptr) {
+			*duration_ += std::chrono::steady_clock::now() - start_;
+		}
+	}
+
+private:
+	std::chrono::nanoseconds *const             duration_;
+	const std::chrono::steady_clock::time_point start_;
+};
+
+/** Print the search statistics. */
+std::ostream &operator<<(std::ostream &os, const SearchStatistics &statistics);
+
+} // namespace tacos::search
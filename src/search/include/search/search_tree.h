@@ -10,16 +10,23 @@
 
 #include "automata/ta_regions.h"
 #include "canonical_word.h"
+#include "flat_word.h"
+#include "mtl_ata_translation/translator.h"
 #include "reg_a.h"
+#include "utilities/concurrent_list.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <queue>
 #include <stdexcept>
+#include <vector>
 
 namespace tacos::search {
 
@@ -51,60 +58,256 @@ enum class LabelReason {
 	GOOD_CONTROLLER_ACTION_FIRST,
 	BAD_ENV_ACTION_FIRST,
 	ALL_CONTROLLER_ACTIONS_BAD,
+	UNEXPANDED,
+	BAD_CONFIGURATION_UNREACHABLE,
 };
 
-/** A node in the search tree
+/** @brief Check whether a canonical word contains the ATA sink location.
+ * A configuration that contains the sink location is not satisfiable.
+ * @param word The word to check
+ * @return true if one of the ATA states of the word is in the sink location
+ */
+template <typename Location, typename ConstraintSymbolType>
+bool
+contains_sink(const CanonicalABWord<Location, ConstraintSymbolType> &word)
+{
+	static const logic::MTLFormula<ConstraintSymbolType> sink{
+	  mtl_ata_translation::get_sink<ConstraintSymbolType>()};
+	return std::any_of(std::begin(word), std::end(word), [](const auto &component) {
+		return std::any_of(std::begin(component), std::end(component), [](const auto &symbol) {
+			const auto *ata_state = std::get_if<ATARegionState<ConstraintSymbolType>>(&symbol);
+			return ata_state != nullptr && ata_state->formula == sink;
+		});
+	});
+}
+
+/** @brief State that is shared by all nodes of a search graph. */
+struct SearchGraphContext
+{
+	/** The number of nodes that have been labeled with TOP or BOTTOM. */
+	std::atomic_size_t labeled_nodes{0};
+};
+
+/** @brief The atomic label of a search node, combined with the number of parents of the node.
+ * Both are stored in a single word, so a node can be canceled with a single compare-and-swap that
+ * fails if a parent has been added since the parents have been checked. Otherwise, this behaves
+ * like std::atomic<NodeLabel>, and changing the label keeps the number of parents.
+ */
+class AtomicNodeLabel
+{
+public:
+	/** Initialize the label of a node without parents.
+	 * @param label The initial label
+	 */
+	AtomicNodeLabel(NodeLabel label = NodeLabel::UNLABELED) : state_(get_state(label, 0))
+	{
+	}
+
+	/** Get the current label. */
+	NodeLabel
+	load() const
+	{
+		return get_label(state_.load());
+	}
+
+	/** Get the current label. */
+	operator NodeLabel() const
+	{
+		return load();
+	}
+
+	/** Set the label.
+	 * @param label The new label
+	 */
+	void
+	store(NodeLabel label)
+	{
+		std::uint64_t state = state_.load();
+		while (!state_.compare_exchange_weak(state, get_state(label, get_num_parents(state)))) {}
+	}
+
+	/** Set the label.
+	 * @param label The new label
+	 * @return The new label
+	 */
+	NodeLabel
+	operator=(NodeLabel label)
+	{
+		store(label);
+		return label;
+	}
+
+	/** Set the label if it has the expected value.
+	 * @param expected The expected label, updated to the current label if it does not match
+	 * @param desired The new label
+	 * @return true if the label has been set
+	 */
+	bool
+	compare_exchange_strong(NodeLabel &expected, NodeLabel desired)
+	{
+		std::uint64_t state = state_.load();
+		while (get_label(state) == expected) {
+			if (state_.compare_exchange_weak(state, get_state(desired, get_num_parents(state)))) {
+				return true;
+			}
+		}
+		expected = get_label(state);
+		return false;
+	}
+
+	/** Get the number of parents that have been counted with add_parent. */
+	std::uint64_t
+	get_num_parents() const
+	{
+		return get_num_parents(state_.load());
+	}
+
+	/** Count a new parent of the node.
+	 * @return The label of the node at the time the parent has been counted
+	 */
+	NodeLabel
+	add_parent()
+	{
+		return get_label(state_.fetch_add(std::uint64_t{1} << label_bits));
+	}
+
+	/** Cancel the unlabeled node if it has the given number of parents.
+	 * @param num_parents The number of parents that have been checked
+	 * @return true if the node has been canceled
+	 */
+	bool
+	cancel(std::uint64_t num_parents)
+	{
+		std::uint64_t expected = get_state(NodeLabel::UNLABELED, num_parents);
+		return state_.compare_exchange_strong(expected, get_state(NodeLabel::CANCELED, num_parents));
+	}
+
+private:
+	static constexpr unsigned label_bits = 8;
+
+	static constexpr std::uint64_t
+	get_state(NodeLabel label, std::uint64_t num_parents)
+	{
+		return (num_parents << label_bits) | static_cast<std::uint64_t>(label);
+	}
+
+	static constexpr NodeLabel
+	get_label(std::uint64_t state)
+	{
+		return static_cast<NodeLabel>(state & ((std::uint64_t{1} << label_bits) - 1));
+	}
+
+	static constexpr std::uint64_t
+	get_num_parents(std::uint64_t state)
+	{
+		return state >> label_bits;
+	}
+
+	std::atomic<std::uint64_t> state_;
+};
+
+/** @brief A node in the search tree.
+ * Nodes are accessed concurrently by the worker threads of the search. The children of a node are
+ * only added by the thread that expands the node and may only be accessed by other threads after
+ * is_expanded has been set. The parents are stored in a lock-free list that only grows, so other
+ * threads may add parents while the node is being labeled. Labels are only changed with atomic
+ * compare-and-swap operations, so each label transition happens exactly once.
  * @see TreeSearch */
 template <typename Location, typename ActionType, typename ConstraintSymbolType = ActionType>
 class SearchTreeNode
 {
 public:
+	/** The type of the list of parents. */
+	using Parents = utilities::ConcurrentList<SearchTreeNode *>;
+
 	/** Construct a node.
 	 * @param words The CanonicalABWords of the node (being of the same reg_a class)
 	 */
-	SearchTreeNode(const std::set<CanonicalABWord<Location, ConstraintSymbolType>> &words)
-	: words(words)
+	SearchTreeNode(std::set<CanonicalABWord<Location, ConstraintSymbolType>> words)
+	: words(std::move(words))
 	{
 		// The constraints must be either over locations or over actions.
 		static_assert(
 		  std::is_same_v<Location,
 		                 ConstraintSymbolType> || std::is_same_v<ActionType, ConstraintSymbolType>);
 		// All words must have the same reg_a.
-		assert(std::all_of(std::begin(words), std::end(words), [&words](const auto &word) {
-			return words.empty() || reg_a(*std::begin(words)) == reg_a(word);
+		assert(std::all_of(std::begin(this->words), std::end(this->words), [this](const auto &word) {
+			return this->words.empty() || reg_a(*std::begin(this->words)) == reg_a(word);
 		}));
+		all_words_contain_sink =
+		  std::all_of(std::begin(this->words), std::end(this->words), [](const auto &word) {
+			  return contains_sink(word);
+		  });
 	}
 
 	/** @brief Set the node label and optionally cancel the children.
+	 * The label is only set if the node is unlabeled. If several threads try to label the node
+	 * concurrently, exactly one of them succeeds.
 	 * @param new_label The new node label
 	 * @param cancel_children If true, cancel children after setting the node label
+	 * @return true if the label has been set by this call
 	 */
-	void
+	bool
 	set_label(NodeLabel new_label, bool cancel_children = false)
 	{
 		assert(new_label != NodeLabel::UNLABELED);
-		// Check if the node has been labeled before. This is an error, unless either the old or the new
-		// label is CANCELED. This is okay, as we may try to cancel a node that has been labeled in the
-		// meantime (or vice versa).
-		if (label != NodeLabel::UNLABELED && label != NodeLabel::CANCELED
-		    && new_label != NodeLabel::CANCELED && label != new_label) {
-			throw std::logic_error(fmt::format(
-			  "Trying to set node label to {}, but it is already set to {}", new_label, label));
+		NodeLabel old_label = NodeLabel::UNLABELED;
+		if (!label.compare_exchange_strong(old_label, new_label)) {
+			// The node has been labeled before. This is an error, unless either the old or the new label
+			// is CANCELED. This is okay, as we may try to cancel a node that has been labeled in the
+			// meantime (or vice versa).
+			if (old_label != NodeLabel::CANCELED && new_label != NodeLabel::CANCELED
+			    && old_label != new_label) {
+				throw std::logic_error(fmt::format(
+				  "Trying to set node label to {}, but it is already set to {}", new_label, old_label));
+			}
+			return false;
+		}
+		if (graph != nullptr && new_label != NodeLabel::CANCELED) {
+			++graph->labeled_nodes;
+		}
+		SPDLOG_DEBUG("Labeling {} {} with {}, reason: {}",
+		             fmt::ptr(this),
+		             *this,
+		             new_label,
+		             label_reason.load());
+		if (cancel_children) {
+			cancel_descendants();
 		}
-		if (label == NodeLabel::UNLABELED) {
-			SPDLOG_DEBUG(
-			  "Labeling {} {} with {}, reason: {}", fmt::ptr(this), *this, new_label, label_reason);
-			label = new_label;
-			if (cancel_children) {
-				for (const auto &action_child : children) {
-					auto child = std::get<1>(action_child);
-					if (std::all_of(std::begin(child->parents),
-					                std::end(child->parents),
-					                [&child](const auto &parent) {
-						                return parent == child.get() || parent->label != NodeLabel::UNLABELED;
-					                })) {
-						child->set_label(NodeLabel::CANCELED, true);
-					}
+		return true;
+	}
+
+	/** @brief Cancel all descendants that are no longer needed.
+	 * A child is canceled if all its parents are labeled, its own children are then canceled in turn.
+	 * Instead of recursing, the descendants are processed in a single batch with a work list. Each
+	 * descendant is canceled by at most one thread. Descendants that are not expanded yet are
+	 * canceled, but their children are not visited.
+	 * The number of parents of a child is read before its parents are checked, and the child is only
+	 * canceled if the number has not changed. As add_child inserts the parent before it counts it, a
+	 * new unlabeled parent is either seen by the check, or it is counted after the child has been
+	 * canceled, in which case the new parent finds the canceled child and resets it.
+	 */
+	void
+	cancel_descendants()
+	{
+		std::vector<SearchTreeNode *> pending{this};
+		while (!pending.empty()) {
+			SearchTreeNode *node = pending.back();
+			pending.pop_back();
+			if (node != this && !node->is_expanded) {
+				continue;
+			}
+			for (const auto &[action, child] : node->children) {
+				const std::uint64_t num_parents = child->label.get_num_parents();
+				if (!std::all_of(std::begin(child->parents),
+				                 std::end(child->parents),
+				                 [&child](const auto &parent) {
+					                 return parent == child.get() || parent->label != NodeLabel::UNLABELED;
+				                 })) {
+					continue;
+				}
+				if (child->label.cancel(num_parents)) {
+					pending.push_back(child.get());
 				}
 			}
 		}
@@ -211,20 +414,20 @@ public:
 		    < std::min(first_bad_environment_step, first_non_good_environment_step)) {
 			// The controller can just select the good controller action.
 			label_reason = LabelReason::GOOD_CONTROLLER_ACTION_FIRST;
-			set_label(NodeLabel::TOP);
+			set_label(NodeLabel::TOP, cancel_children);
 		} else if (has_enviroment_step
 		           && std::min(first_bad_environment_step, first_non_good_environment_step)
 		                == std::numeric_limits<RegionIndex>::max()) {
 			// There is an environment action and no environment action is bad
 			// -> the controller can just select all environment actions
 			label_reason = LabelReason::NO_BAD_ENV_ACTION;
-			set_label(NodeLabel::TOP);
+			set_label(NodeLabel::TOP, cancel_children);
 		} else if (!has_enviroment_step && first_good_controller_step == max
 		           && first_non_bad_controller_step == max) {
 			// All controller actions must be bad (otherwise we would be in the first case)
 			// -> no controller strategy
 			label_reason = LabelReason::ALL_CONTROLLER_ACTIONS_BAD;
-			set_label(NodeLabel::BOTTOM);
+			set_label(NodeLabel::BOTTOM, cancel_children);
 		} else if (has_enviroment_step
 		           && first_bad_environment_step
 		                < std::min(first_good_controller_step, first_non_bad_controller_step)) {
@@ -232,7 +435,7 @@ public:
 			// (otherwise case 2).
 			assert(first_bad_environment_step < std::numeric_limits<RegionIndex>::max());
 			label_reason = LabelReason::BAD_ENV_ACTION_FIRST;
-			set_label(NodeLabel::BOTTOM);
+			set_label(NodeLabel::BOTTOM, cancel_children);
 		}
 		if (label != NodeLabel::UNLABELED) {
 			for (const auto &parent : parents) {
@@ -267,10 +470,14 @@ public:
 	}
 
 	/** Add a child to the node.
+	 * If the child can be reached faster through this node, its min_total_region_increments is
+	 * updated and the improvement is propagated to its descendants.
 	 * @param action Taking this action in the current node leads to the new child node
 	 * @param node The new child
+	 * @return The nodes whose min_total_region_increments has decreased
+	 * @see update_min_total_region_increments
 	 */
-	void
+	std::vector<SearchTreeNode *>
 	add_child(const std::pair<RegionIndex, ActionType> &action, std::shared_ptr<SearchTreeNode> node)
 	{
 		if (!children.insert(std::make_pair(action, node)).second) {
@@ -282,28 +489,100 @@ public:
 			                                        action.first,
 			                                        action.second));
 		}
-		node->min_total_region_increments =
-		  std::min(node->min_total_region_increments, min_total_region_increments + action.first);
-		node->parents.insert(this);
+		// Only the thread that expands this node adds its children, so this node is never inserted
+		// twice into the same list of parents. Other parents may be inserted concurrently.
+		if (!node->parents.contains(this)) {
+			node->parents.push_front(this);
+			// The parent is counted after it has been inserted, see cancel_descendants.
+			node->label.add_parent();
+		}
+		return node->update_min_total_region_increments(min_total_region_increments + action.first);
+	}
+
+	/** @brief Decrease the minimal total time to reach the children from the time of this node.
+	 * A concurrent update of this node does not visit its children while the node is being expanded.
+	 * Thus, the thread that expands the node calls this after is_expanded has been set if the time
+	 * of the node has changed during the expansion.
+	 * @return The nodes whose min_total_region_increments has decreased
+	 */
+	std::vector<SearchTreeNode *>
+	update_children_min_total_region_increments()
+	{
+		std::vector<SearchTreeNode *> improved_nodes;
+		for (const auto &[timed_action, child] : children) {
+			const auto improved = child->update_min_total_region_increments(
+			  min_total_region_increments + timed_action.first);
+			improved_nodes.insert(std::end(improved_nodes), std::begin(improved), std::end(improved));
+		}
+		return improved_nodes;
+	}
+
+	/** @brief Decrease the minimal total time to reach this node and propagate it to the descendants.
+	 * The shortest paths over the search graph are maintained incrementally: if the given value is
+	 * lower than the current one, the new value is propagated to all descendants in the order of
+	 * their distance, just like Dijkstra's algorithm. Thus, each descendant is updated at most once
+	 * per call. The values are only ever decreased with compare-and-swap, so several updates may run
+	 * concurrently. Only the children of expanded nodes are visited, the children of a node that is
+	 * being expanded are updated by update_children_min_total_region_increments.
+	 * @param increments The new number of region increments to reach this node
+	 * @return The nodes whose min_total_region_increments has decreased
+	 */
+	std::vector<SearchTreeNode *>
+	update_min_total_region_increments(RegionIndex increments)
+	{
+		std::vector<SearchTreeNode *> improved_nodes;
+		using Entry = std::pair<RegionIndex, SearchTreeNode *>;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+		queue.emplace(increments, this);
+		while (!queue.empty()) {
+			const auto [distance, node] = queue.top();
+			queue.pop();
+			RegionIndex current = node->min_total_region_increments;
+			while (distance < current
+			       && !node->min_total_region_increments.compare_exchange_weak(current, distance)) {}
+			if (distance >= current) {
+				continue;
+			}
+			improved_nodes.push_back(node);
+			if (!node->is_expanded) {
+				continue;
+			}
+			for (const auto &[timed_action, child] : node->children) {
+				if (distance + timed_action.first < child->min_total_region_increments) {
+					queue.emplace(distance + timed_action.first, child.get());
+				}
+			}
+		}
+		return improved_nodes;
 	}
 
 	/** The words of the node */
 	std::set<CanonicalABWord<Location, ConstraintSymbolType>> words;
+	/** The flattened words of the node, in the same order as the words. This is empty if the node
+	 * has not been flattened, e.g., if it has been created outside of a TreeSearch. */
+	std::vector<FlatWord> flat_words;
+	/** Whether each word of the node contains the ATA sink location. This is computed once when the
+	 * node is constructed, as the words never change. */
+	bool all_words_contain_sink;
 	/** The state of the node */
 	std::atomic<NodeState> state = NodeState::UNKNOWN;
 	/** Whether we have a successful strategy in the node */
-	std::atomic<NodeLabel> label = NodeLabel::UNLABELED;
-	/** The parent of the node, this node was directly reached from the parent */
-	std::set<SearchTreeNode *> parents = {};
+	AtomicNodeLabel label = NodeLabel::UNLABELED;
+	/** The parents of the node, this node was directly reached from each parent */
+	Parents parents;
 	/** Whether the node has been expanded. This is used for multithreading, in particular to check
 	 * whether we can access the children already. */
 	std::atomic_bool is_expanded{false};
 	/** Whether the node is currently being expanded. */
 	std::atomic_bool is_expanding{false};
+	/** The search graph that contains this node, or nullptr if the node is not part of a
+	 * TreeSearch. The graph must outlive the labeling of the node. */
+	SearchGraphContext *graph{nullptr};
 	/** A more detailed description for the node that explains the current label. */
-	LabelReason label_reason = LabelReason::UNKNOWN;
-	/** The current regionalized minimal total time to reach this node */
-	RegionIndex min_total_region_increments = std::numeric_limits<RegionIndex>::max();
+	std::atomic<LabelReason> label_reason = LabelReason::UNKNOWN;
+	/** The current regionalized minimal total time to reach this node. This is atomic so heuristics
+	 * may read it while it is updated. */
+	std::atomic<RegionIndex> min_total_region_increments = std::numeric_limits<RegionIndex>::max();
 
 private:
 	/** A list of the children of the node, which are reachable by a single transition */
@@ -0,0 +1,157 @@
+/***************************************************************************
+ *  symbol_table.h - Canonical indexes of the symbols of canonical words
+ *
+ *  Created:   Fri 16 Oct 2026 16:02:08 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include "canonical_word.h"
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace tacos::search {
+
+/** @brief The locations, clocks, and formulas that may occur in the canonical words of a search.
+ * The symbols are kept in sorted sets, so the alphabet does not depend on the order in which the
+ * symbols are added.
+ * @tparam Location The location type of the plant
+ * @tparam ConstraintSymbolType The type of the constraint symbols of the specification
+ */
+template <typename Location, typename ConstraintSymbolType>
+struct SymbolAlphabet
+{
+	/** The locations of the plant */
+	std::set<Location> locations;
+	/** The clocks of the plant */
+	std::set<std::string> clocks;
+	/** The locations of the ATA, i.e., the formulas of its states */
+	std::set<logic::MTLFormula<ConstraintSymbolType>> formulas;
+
+	/** Add all symbols of a word to the alphabet.
+	 * @param word The word to add
+	 */
+	void
+	insert(const CanonicalABWord<Location, ConstraintSymbolType> &word)
+	{
+		for (const auto &partition : word) {
+			for (const auto &symbol : partition) {
+				if (const auto *state = std::get_if<PlantRegionState<Location>>(&symbol)) {
+					locations.insert(state->location);
+					clocks.insert(state->clock);
+				} else {
+					formulas.insert(std::get<ATARegionState<ConstraintSymbolType>>(symbol).formula);
+				}
+			}
+		}
+	}
+};
+
+/** @brief Assign an index to each symbol of one kind, e.g., to each location.
+ * The symbols that are known in advance get their rank in the sorted set as index. These indexes
+ * never change, so looking them up does not take a lock, and two tables with the same known symbols
+ * assign the same indexes. Other symbols, e.g., the locations of a plant that cannot be enumerated,
+ * get the next free index when they are first looked up, which takes a lock. All methods may be
+ * called concurrently.
+ * @tparam Symbol The type of the symbols
+ */
+template <typename Symbol>
+class SymbolTable
+{
+public:
+	/** Initialize the table with the symbols that are known in advance.
+	 * @param symbols The known symbols
+	 * @param max_size The maximal number of symbols of the table
+	 * @throws std::invalid_argument if there are more than max_size known symbols
+	 */
+	explicit SymbolTable(const std::set<Symbol> &symbols  = {},
+	                     std::uint64_t           max_size = std::numeric_limits<std::uint64_t>::max())
+	: max_size_(max_size), known_symbols_(std::begin(symbols), std::end(symbols))
+	{
+		if (known_symbols_.size() > max_size_) {
+			throw std::invalid_argument("Too many distinct symbols for a symbol table");
+		}
+		for (std::uint64_t index = 0; index < known_symbols_.size(); ++index) {
+			known_indexes_.emplace_hint(std::end(known_indexes_), known_symbols_[index], index);
+		}
+	}
+
+	/** Get the index of a symbol, assign a new index if the symbol is unknown.
+	 * @param symbol The symbol to look up
+	 * @return The index of the symbol
+	 * @throws std::invalid_argument if the table is full
+	 */
+	std::uint64_t
+	get_index(const Symbol &symbol)
+	{
+		if (auto index = known_indexes_.find(symbol); index != std::end(known_indexes_)) {
+			return index->second;
+		}
+		{
+			std::shared_lock lock{mutex_};
+			if (auto index = added_indexes_.find(symbol); index != std::end(added_indexes_)) {
+				return index->second;
+			}
+		}
+		std::unique_lock lock{mutex_};
+		if (auto index = added_indexes_.find(symbol); index != std::end(added_indexes_)) {
+			return index->second;
+		}
+		const std::uint64_t index = known_symbols_.size() + added_symbols_.size();
+		if (index >= max_size_) {
+			throw std::invalid_argument("Too many distinct symbols for a symbol table");
+		}
+		added_symbols_.push_back(symbol);
+		return added_indexes_.emplace(symbol, index).first->second;
+	}
+
+	/** Get the symbol with the given index.
+	 * @param index The index of the symbol
+	 * @return The symbol, which stays valid as long as the table exists
+	 * @throws std::invalid_argument if no symbol has the index
+	 */
+	const Symbol &
+	get_symbol(std::uint64_t index) const
+	{
+		if (index < known_symbols_.size()) {
+			return known_symbols_[index];
+		}
+		std::shared_lock lock{mutex_};
+		if (index - known_symbols_.size() >= added_symbols_.size()) {
+			throw std::invalid_argument("Unknown symbol index " + std::to_string(index));
+		}
+		return added_symbols_[index - known_symbols_.size()];
+	}
+
+	/** Check whether all symbols that have been looked up were known in advance.
+	 * Only then, the indexes do not depend on the order of the lookups.
+	 */
+	bool
+	is_canonical() const
+	{
+		std::shared_lock lock{mutex_};
+		return added_symbols_.empty();
+	}
+
+private:
+	const std::uint64_t             max_size_;
+	const std::vector<Symbol>       known_symbols_;
+	std::map<Symbol, std::uint64_t> known_indexes_;
+	mutable std::shared_mutex       mutex_;
+	std::map<Symbol, std::uint64_t> added_indexes_;
+	std::deque<Symbol>              added_symbols_;
+};
+
+} // namespace tacos::search
@@ -31,14 +31,14 @@ namespace tacos::search {
 /// Increment the region indexes in the configurations of the given ABRegionSymbol.
 /** This is a helper function to increase the region index so we reach the next region set.
  * @param configurations The set of configurations to increment the region indexes in
- * @param max_region_index The maximal region index that may never be passed
+ * @param K The maximal constants, which determine the maximal region index of each configuration
  * @return A copy of the given configurations with incremented region indexes
  */
 template <typename Location, typename ConstraintSymbolType>
 std::set<ABRegionSymbol<Location, ConstraintSymbolType>>
 increment_region_indexes(
   const std::set<ABRegionSymbol<Location, ConstraintSymbolType>> &configurations,
-  RegionIndex                                                     max_region_index)
+  const MaxConstantsParam<ConstraintSymbolType>                  &K)
 {
 	// Assert that our assumption holds: All region indexes are either odd or even, never mixed.
 	assert(
@@ -54,7 +54,8 @@ increment_region_indexes(
 	std::transform(configurations.begin(),
 	               configurations.end(),
 	               std::inserter(res, res.end()),
-	               [max_region_index](auto configuration) {
+	               [&K](auto configuration) {
+		               const RegionIndex max_region_index = K.get_max_region_index(configuration);
 		               if (std::holds_alternative<PlantRegionState<Location>>(configuration)) {
 			               auto &ta_configuration = std::get<PlantRegionState<Location>>(configuration);
 			               RegionIndex &region_index = ta_configuration.region_index;
@@ -84,31 +85,32 @@ increment_region_indexes(
  * increasing the clock value with the maximal fractional part such that it
  * reaches the next region.
  * @param word The word for which to compute the time successor
- * @param K The upper bound for all constants appearing in clock constraints
+ * @param K The upper bound for all constants appearing in clock constraints, either a single
+ * constant or the maximal constant of each clock
  * @return A CanonicalABWord that directly follows the given word time-wise,
  * i.e., all Abs_i in the word Abs are the same except the last component,
  * which is incremented to the next region.
  */
 template <typename Location, typename ConstraintSymbolType>
 CanonicalABWord<Location, ConstraintSymbolType>
-get_time_successor(const CanonicalABWord<Location, ConstraintSymbolType> &word, RegionIndex K)
+get_time_successor(const CanonicalABWord<Location, ConstraintSymbolType> &word,
+                   const MaxConstantsParam<ConstraintSymbolType>         &K)
 {
 	if (word.empty()) {
 		return {};
 	}
 	CanonicalABWord<Location, ConstraintSymbolType> res;
-	const RegionIndex                               max_region_index = 2 * K + 1;
-	assert(is_valid_canonical_word(word, max_region_index));
+	assert(is_valid_canonical_word(word, K.get_max_region_index()));
+	// A configuration is maxed if it reached the maximal region index of its clock.
+	auto is_maxed = [&K](const auto &configuration) {
+		return get_region_index(configuration) == K.get_max_region_index(configuration);
+	};
 	// Find the partition that contains all maxed partitions. If it does not exist, create an empty
 	// one.
 	std::set<ABRegionSymbol<Location, ConstraintSymbolType>> new_maxed_partition;
 	auto last_nonmaxed_partition = std::next(word.rbegin());
 	// Check if maxed partition is actually maxed
-	if (std::all_of(word.rbegin()->begin(),
-	                word.rbegin()->end(),
-	                [&max_region_index](const auto &configuration) {
-		                return get_region_index(configuration) == max_region_index;
-	                })) {
+	if (std::all_of(word.rbegin()->begin(), word.rbegin()->end(), is_maxed)) {
 		new_maxed_partition = *word.rbegin();
 	} else {
 		// There is no maxed partition, so the last partition is already nonmaxed.
@@ -121,10 +123,10 @@ get_time_successor(const CanonicalABWord<Location, ConstraintSymbolType> &word,
 	const bool has_even_region_index = get_region_index(*word.begin()->begin()) % 2 == 0;
 	// The first set needs to be incremented if its region indexes are even.
 	if (has_even_region_index) {
-		auto incremented = increment_region_indexes(*word.begin(), max_region_index);
+		auto incremented = increment_region_indexes(*word.begin(), K);
 		std::set<ABRegionSymbol<Location, ConstraintSymbolType>> incremented_nonmaxed;
 		for (auto &configuration : incremented) {
-			if (get_region_index(configuration) == max_region_index) {
+			if (is_maxed(configuration)) {
 				new_maxed_partition.insert(configuration);
 			} else {
 				incremented_nonmaxed.insert(configuration);
@@ -137,10 +139,10 @@ get_time_successor(const CanonicalABWord<Location, ConstraintSymbolType> &word,
 	} else {
 		// Increment the last nonmaxed partition. If we have a new maxed configuration, put it into the
 		// maxed partition. Otherwise, keep it in place.
-		auto incremented = increment_region_indexes(*last_nonmaxed_partition, max_region_index);
+		auto incremented = increment_region_indexes(*last_nonmaxed_partition, K);
 		std::set<ABRegionSymbol<Location, ConstraintSymbolType>> incremented_nonmaxed;
 		for (auto &configuration : incremented) {
-			if (get_region_index(configuration) == max_region_index) {
+			if (is_maxed(configuration)) {
 				new_maxed_partition.insert(configuration);
 			} else {
 				incremented_nonmaxed.insert(configuration);
@@ -156,7 +158,7 @@ get_time_successor(const CanonicalABWord<Location, ConstraintSymbolType> &word,
 	if (!new_maxed_partition.empty()) {
 		res.push_back(std::move(new_maxed_partition));
 	}
-	assert(is_valid_canonical_word(res, max_region_index));
+	assert(is_valid_canonical_word(res, K.get_max_region_index()));
 	return res;
 }
 
@@ -209,12 +211,49 @@ get_candidate(const CanonicalABWord<Location, ConstraintSymbolType> &word)
 	return std::make_pair(plant_configuration, ata_configuration);
 }
 
+/** @brief Check whether a canonical word represents an accepting configuration.
+ * This is equivalent to checking the candidate of the word (see get_candidate) for acceptance in
+ * both automata, but it does not construct the candidate. As acceptance does not depend on the
+ * clock valuations, it suffices to check the plant location and the ATA formulas of the word. The
+ * check stops at the first location that is not accepting.
+ * @param plant The plant, e.g., a timed automaton
+ * @param ata The ATA of the specification
+ * @param word The word to check
+ * @return true if the word's plant location and all its ATA formulas are accepting
+ */
+template <typename Plant, typename ATA, typename Location, typename ConstraintSymbolType>
+bool
+is_accepting_word(const Plant                                           &plant,
+                  const ATA                                             &ata,
+                  const CanonicalABWord<Location, ConstraintSymbolType> &word)
+{
+	// All plant symbols of a valid word share the same location, so check the first one.
+	const PlantRegionState<Location> *plant_state = nullptr;
+	for (auto partition = std::begin(word); plant_state == nullptr && partition != std::end(word);
+	     ++partition) {
+		for (const auto &symbol : *partition) {
+			if ((plant_state = std::get_if<PlantRegionState<Location>>(&symbol)) != nullptr) {
+				break;
+			}
+		}
+	}
+	if (!plant.is_accepting_location(plant_state ? plant_state->location : Location{})) {
+		return false;
+	}
+	return std::all_of(std::begin(word), std::end(word), [&ata](const auto &partition) {
+		return std::all_of(std::begin(partition), std::end(partition), [&ata](const auto &symbol) {
+			const auto *ata_state = std::get_if<ATARegionState<ConstraintSymbolType>>(&symbol);
+			return ata_state == nullptr || ata.is_accepting_location(ata_state->formula);
+		});
+	});
+}
+
 /** Get the nth time successor. */
 template <typename Location, typename ConstraintSymbolType>
 CanonicalABWord<Location, ConstraintSymbolType>
 get_nth_time_successor(const CanonicalABWord<Location, ConstraintSymbolType> &word,
                        RegionIndex                                            n,
-                       RegionIndex                                            K)
+                       const MaxConstantsParam<ConstraintSymbolType>         &K)
 {
 	auto res = word;
 	for (RegionIndex i = 0; i < n; i++) {
@@ -231,9 +270,11 @@ get_nth_time_successor(const CanonicalABWord<Location, ConstraintSymbolType> &wo
 template <typename Location, typename ConstraintSymbolType>
 std::vector<std::pair<RegionIndex, CanonicalABWord<Location, ConstraintSymbolType>>>
 get_time_successors(const CanonicalABWord<Location, ConstraintSymbolType> &canonical_word,
-                    RegionIndex                                            K)
+                    const MaxConstantsParam<ConstraintSymbolType>         &K)
 {
-	SPDLOG_TRACE("Computing time successors of {} with K={}", canonical_word, K);
+	SPDLOG_TRACE("Computing time successors of {} with K={}",
+	             canonical_word,
+	             K.get_largest_constant());
 	auto        cur = get_time_successor(canonical_word, K);
 	RegionIndex cur_index{0};
 	std::vector<std::pair<RegionIndex, CanonicalABWord<Location, ConstraintSymbolType>>>
@@ -254,7 +295,7 @@ template <typename Location, typename ConstraintSymbolType>
 std::set<CanonicalABWord<Location, ConstraintSymbolType>>
 get_next_time_successors(
   const std::set<CanonicalABWord<Location, ConstraintSymbolType>> &canonical_words,
-  RegionIndex                                                      K)
+  const MaxConstantsParam<ConstraintSymbolType>                   &K)
 {
 	assert(!canonical_words.empty());
 	assert(std::all_of(std::begin(canonical_words), std::end(canonical_words), [&](const auto &word) {
@@ -298,7 +339,7 @@ template <typename Location, typename ConstraintSymbolType>
 std::vector<std::set<CanonicalABWord<Location, ConstraintSymbolType>>>
 get_time_successors(
   const std::set<CanonicalABWord<Location, ConstraintSymbolType>> &canonical_words,
-  RegionIndex                                                      K)
+  const MaxConstantsParam<ConstraintSymbolType>                   &K)
 {
 	std::vector<std::set<CanonicalABWord<Location, ConstraintSymbolType>>> successors;
 	successors.push_back(canonical_words);
@@ -10,11 +10,15 @@
 #pragma once
 
 #include "adapter.h"
+#include "automata/ta_region_graph.h"
 #include "canonical_word.h"
+#include "utilities/lru_cache.h"
 #include "utilities/types.h"
 
 #include <spdlog/spdlog.h>
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace tacos::search {
@@ -42,10 +46,60 @@ class get_next_canonical_words<automata::ta::TimedAutomaton<LocationT, ActionTyp
                                use_location_constraints>
 {
 public:
+	/** The transitions enabled in a plant configuration, grouped by their symbol. */
+	using EnabledTransitions =
+	  typename automata::ta::RegionGraph<LocationT, ActionType>::EnabledTransitions;
+	/** The cache of enabled transitions, indexed by the maximal constant and the regionalized
+	 * configuration. */
+	using SuccessorCache = utilities::LruCache<
+	  std::pair<RegionIndex, automata::ta::RegionalizedConfiguration<LocationT>>,
+	  EnabledTransitions>;
+
 	get_next_canonical_words(const std::set<ActionType> & = {}, const std::set<ActionType> & = {})
 	{
 	}
-	/** Get the next canonical words. */
+
+	/** Use a precomputed region graph of the plant to compute the plant's successors.
+	 * If the region graph does not contain a configuration or it was computed with a different
+	 * maximal constant, the successors are computed directly on the plant.
+	 * @param region_graph The region graph of the plant, must outlive this object; nullptr to disable
+	 */
+	void
+	set_region_graph(const automata::ta::RegionGraph<LocationT, ActionType> *region_graph)
+	{
+		region_graph_ = region_graph;
+	}
+
+	/** @brief Cache the transitions that are enabled in the plant's regionalized configurations.
+	 * The transitions that are enabled in a configuration only depend on its location and the region
+	 * index of each clock. Many words share the same plant part and only differ in the ATA part, so
+	 * the enabled transitions are cached and shared by all nodes and threads of the search. If the
+	 * cache is full, the least recently used configuration is evicted. The cache is only used if no
+	 * region graph is set. The cache keeps pointers to the plant's transitions, so the successor
+	 * generator must only be used with a single plant afterwards.
+	 * @param capacity The maximal number of cached configurations, 0 to disable the cache
+	 */
+	void
+	enable_successor_cache(std::size_t capacity)
+	{
+		if (capacity == 0) {
+			successor_cache_ = nullptr;
+		} else {
+			successor_cache_ = std::make_shared<SuccessorCache>(capacity);
+		}
+	}
+
+	/** Get the cache of enabled transitions, e.g., to get its hit rate.
+	 * @return A pointer to the cache, or nullptr if it is disabled
+	 */
+	const SuccessorCache *
+	get_successor_cache() const
+	{
+		return successor_cache_.get();
+	}
+
+	/** Get the next canonical words.
+	 * If statistics are given, the time spent in plant and ATA steps is added to them. */
 	std::multimap<
 	  ActionType,
 	  CanonicalABWord<typename automata::ta::TimedAutomaton<LocationT, ActionType>::Location,
@@ -58,7 +112,8 @@ public:
 	  const std::pair<typename automata::ta::TimedAutomaton<LocationT, ActionType>::Configuration,
 	                  ATAConfiguration<ConstraintSymbolType>> &ab_configuration,
 	  const RegionIndex,
-	  const RegionIndex K)
+	  const MaxConstants<ConstraintSymbolType> &K,
+	  SearchStatistics                         *statistics = nullptr)
 	{
 		static_assert(use_location_constraints || std::is_same_v<ActionType, ConstraintSymbolType>);
 		static_assert(
@@ -70,12 +125,38 @@ public:
 		  CanonicalABWord<typename automata::ta::TimedAutomaton<LocationT, ActionType>::Location,
 		                  ConstraintSymbolType>>
 		  successors;
+		std::chrono::nanoseconds *const plant_step_time =
+		  statistics == nullptr ? nullptr : &statistics->plant_step_time;
+		std::chrono::nanoseconds *const ata_step_time =
+		  statistics == nullptr ? nullptr : &statistics->ata_step_time;
+		const EnabledTransitions                  *enabled_transitions = nullptr;
+		std::shared_ptr<const EnabledTransitions> cached_transitions;
+		// The enabled transitions only depend on the region w.r.t. the largest constant.
+		const RegionIndex largest_constant = K.get_largest_constant();
+		if (region_graph_ != nullptr && region_graph_->get_max_constant() == largest_constant) {
+			ScopedTimer timer{plant_step_time};
+			enabled_transitions = region_graph_->get_enabled_transitions(
+			  automata::ta::get_regionalized_configuration(ab_configuration.first, largest_constant));
+		} else if (successor_cache_ != nullptr) {
+			ScopedTimer timer{plant_step_time};
+			cached_transitions =
+			  get_cached_transitions(ta, ab_configuration.first, largest_constant, statistics);
+			enabled_transitions = cached_transitions.get();
+		}
 		for (const auto &symbol : ta.get_alphabet()) {
 			SPDLOG_TRACE("({}, {}): Symbol {}", ab_configuration.first, ab_configuration.second, symbol);
-			const std::set<typename automata::ta::TimedAutomaton<LocationT, ActionType>::Configuration>
-			  ta_successors = ta.make_symbol_step(ab_configuration.first, symbol);
+			std::set<typename automata::ta::TimedAutomaton<LocationT, ActionType>::Configuration>
+			  ta_successors;
+			{
+				ScopedTimer timer{plant_step_time};
+				ta_successors =
+				  enabled_transitions == nullptr
+				    ? ta.make_symbol_step(ab_configuration.first, symbol)
+				    : get_plant_successors(ab_configuration.first, *enabled_transitions, symbol);
+			}
 			std::set<ATAConfiguration<ConstraintSymbolType>> ata_successors;
 			if constexpr (!use_location_constraints) {
+				ScopedTimer timer{ata_step_time};
 				ata_successors = ata.make_symbol_step(ab_configuration.second, symbol);
 			}
 			SPDLOG_TRACE("({}, {}): TA successors: {} ATA successors: {}",
@@ -89,6 +170,7 @@ public:
 				             ab_configuration.second,
 				             ta_successor);
 				if constexpr (use_location_constraints) {
+					ScopedTimer timer{ata_step_time};
 					ata_successors = ata.make_symbol_step(ab_configuration.second,
 					                                      logic::AtomicProposition{ta_successor.location});
 				}
@@ -109,6 +191,62 @@ public:
 		}
 		return successors;
 	}
+
+private:
+
+	/** Get the transitions enabled in the plant configuration from the cache, or compute and cache
+	 * them if they are not cached yet. */
+	std::shared_ptr<const EnabledTransitions>
+	get_cached_transitions(const automata::ta::TimedAutomaton<LocationT, ActionType> &ta,
+	                       const TAConfiguration<LocationT> &configuration,
+	                       RegionIndex                       K,
+	                       SearchStatistics                 *statistics) const
+	{
+		auto key = std::make_pair(K, automata::ta::get_regionalized_configuration(configuration, K));
+		if (auto transitions = successor_cache_->get(key)) {
+			if (statistics != nullptr) {
+				++statistics->successor_cache_hits;
+			}
+			return transitions;
+		}
+		if (statistics != nullptr) {
+			++statistics->successor_cache_misses;
+		}
+		EnabledTransitions transitions;
+		for (const auto &symbol : ta.get_alphabet()) {
+			for (const auto *transition : ta.get_transitions(configuration.location, symbol)) {
+				if (transition->is_enabled(symbol, configuration.clock_valuations)) {
+					transitions[symbol].push_back(transition);
+				}
+			}
+		}
+		return successor_cache_->put(key, std::move(transitions));
+	}
+
+	/** Compute the plant's successors from the transitions enabled in its region. */
+	static std::set<TAConfiguration<LocationT>>
+	get_plant_successors(
+	  const TAConfiguration<LocationT>                                                 &configuration,
+	  const typename automata::ta::RegionGraph<LocationT, ActionType>::EnabledTransitions &enabled,
+	  const ActionType                                                                 &symbol)
+	{
+		std::set<TAConfiguration<LocationT>> res;
+		auto                                 transitions = enabled.find(symbol);
+		if (transitions == std::end(enabled)) {
+			return res;
+		}
+		for (const auto &transition : transitions->second) {
+			ClockSetValuation next_clocks = configuration.clock_valuations;
+			for (const auto &name : transition->get_reset()) {
+				next_clocks[name].reset();
+			}
+			res.insert(TAConfiguration<LocationT>{transition->get_target(), next_clocks});
+		}
+		return res;
+	}
+
+	const automata::ta::RegionGraph<LocationT, ActionType> *region_graph_{nullptr};
+	std::shared_ptr<SuccessorCache>                         successor_cache_;
 };
 
 } // namespace tacos::search
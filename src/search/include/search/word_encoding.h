@@ -0,0 +1,315 @@
+/***************************************************************************
+ *  word_encoding.h - Compact binary encoding of canonical words
+ *
+ *  Created:   Fri 16 Oct 2026 14:12:21 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include "canonical_word.h"
+#include "symbol_table.h"
+#include "utilities/varint.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tacos::search {
+
+namespace details {
+
+/** Read the number of elements that follow in an encoding.
+ * The number is checked against the remaining size of the encoding before anything is allocated,
+ * so a corrupt encoding cannot cause a huge allocation.
+ * @param encoding The encoding, the number is removed from its front
+ * @param min_element_size The minimal number of bytes of each element
+ * @return The number of elements
+ * @throws std::invalid_argument if the encoding is too short for the number of elements
+ */
+inline std::uint64_t
+read_count(std::string_view &encoding, std::size_t min_element_size)
+{
+	const auto count = utilities::read_varint(encoding);
+	if (count > encoding.size() / min_element_size) {
+		throw std::invalid_argument("Invalid number of elements in word encoding");
+	}
+	return count;
+}
+
+} // namespace details
+
+/** @brief A view on a set of encoded words that splits the encoding without copying.
+ * The view does not own the encoding, it must outlive the view.
+ */
+class EncodedWordsView
+{
+public:
+	/** @brief A forward iterator over the encoded words of the set. */
+	class const_iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type        = std::string_view;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = const std::string_view *;
+		using reference         = const std::string_view &;
+
+		/** Construct an iterator over the remaining words in the encoding. */
+		const_iterator(std::string_view remaining, std::size_t remaining_words)
+		: remaining(remaining), remaining_words(remaining_words)
+		{
+			read_word();
+		}
+		/** Access the current encoded word. */
+		reference
+		operator*() const
+		{
+			return word;
+		}
+		/** Access the current encoded word. */
+		pointer
+		operator->() const
+		{
+			return &word;
+		}
+		/** Advance to the next word. */
+		const_iterator &
+		operator++()
+		{
+			read_word();
+			return *this;
+		}
+		/** Compare two iterators. */
+		bool
+		operator==(const const_iterator &other) const
+		{
+			return remaining_words == other.remaining_words && word.data() == other.word.data();
+		}
+		/** Compare two iterators. */
+		bool
+		operator!=(const const_iterator &other) const
+		{
+			return !(*this == other);
+		}
+
+	private:
+		void
+		read_word()
+		{
+			if (remaining_words == 0) {
+				word = std::string_view{};
+				return;
+			}
+			const auto length = utilities::read_varint(remaining);
+			if (length > remaining.size()) {
+				throw std::invalid_argument("Truncated word encoding");
+			}
+			word = remaining.substr(0, length);
+			remaining.remove_prefix(length);
+			--remaining_words;
+		}
+
+		std::string_view remaining;
+		std::size_t      remaining_words;
+		std::string_view word;
+	};
+
+	/** Construct a view on the given encoding of a set of words.
+	 * @param encoding The encoding as created by WordEncoder::encode_words
+	 * @throws std::invalid_argument if the encoding is truncated
+	 */
+	explicit EncodedWordsView(std::string_view encoding) : words(encoding)
+	{
+		// Each word is prefixed by its length.
+		num_words = details::read_count(words, 1);
+	}
+	/** Get the number of words in the set. */
+	std::size_t
+	size() const
+	{
+		return num_words;
+	}
+	/** Get an iterator to the first encoded word. */
+	const_iterator
+	begin() const
+	{
+		return const_iterator{words, num_words};
+	}
+	/** Get the end iterator. */
+	const_iterator
+	end() const
+	{
+		return const_iterator{std::string_view{}, 0};
+	}
+
+private:
+	std::string_view words;
+	std::size_t      num_words;
+};
+
+/** @brief Encode canonical words into a compact and deterministic binary format.
+ * All numbers are encoded as LEB128 varints. Locations, clocks, and formulas are replaced by
+ * indexes into symbol tables of the encoder. Each symbol of the alphabet that is passed to the
+ * constructor gets its rank in the sorted alphabet as index, e.g., the first location in the
+ * order of locations gets the index 0. Thus, two encoders with the same alphabet, e.g., the
+ * alphabet of the plant and the ATA of a search, produce the same encoding, independent of the
+ * order in which they encode words. Symbols that are not in the alphabet get the next free index
+ * when they are first encoded, so their encoding depends on the encoder. Two equal words always
+ * have the same encoding with the same encoder, and the encoding can be used as key for hashing
+ * and deduplication. A word is encoded as the number of its components, followed by each
+ * component. A component is encoded as the number of its symbols, followed by each symbol. A
+ * symbol is encoded as its region index shifted by one bit, where the lowest bit is set for ATA
+ * states, followed by the location and clock indexes for plant states, or the formula index for
+ * ATA states. A set of words is encoded as the number of words, followed by each word prefixed by
+ * its length in bytes, so it can be split into its words with an EncodedWordsView without decoding
+ * them. All methods may be called concurrently.
+ * @tparam Location The location type of the plant
+ * @tparam ConstraintSymbolType The type of the constraint symbols of the specification
+ */
+template <typename Location, typename ConstraintSymbolType>
+class WordEncoder
+{
+public:
+	/** The word type to encode */
+	using Word = CanonicalABWord<Location, ConstraintSymbolType>;
+
+	/** Initialize the encoder.
+	 * @param alphabet The symbols that are known in advance, which get their rank in the sorted
+	 * alphabet as index
+	 */
+	explicit WordEncoder(const SymbolAlphabet<Location, ConstraintSymbolType> &alphabet = {})
+	: locations_(alphabet.locations), clocks_(alphabet.clocks), formulas_(alphabet.formulas)
+	{
+	}
+
+	/** Encode a single word and append it to a buffer.
+	 * @param word The word to encode
+	 * @param buffer The buffer to append the encoding to
+	 */
+	void
+	encode_word(const Word &word, std::string &buffer)
+	{
+		utilities::append_varint(word.size(), buffer);
+		for (const auto &component : word) {
+			utilities::append_varint(component.size(), buffer);
+			for (const auto &symbol : component) {
+				if (std::holds_alternative<PlantRegionState<Location>>(symbol)) {
+					const auto &state = std::get<PlantRegionState<Location>>(symbol);
+					utilities::append_varint(static_cast<std::uint64_t>(state.region_index) << 1, buffer);
+					utilities::append_varint(locations_.get_index(state.location), buffer);
+					utilities::append_varint(clocks_.get_index(state.clock), buffer);
+				} else {
+					const auto &state = std::get<ATARegionState<ConstraintSymbolType>>(symbol);
+					utilities::append_varint((static_cast<std::uint64_t>(state.region_index) << 1) | 1,
+					                         buffer);
+					utilities::append_varint(formulas_.get_index(state.formula), buffer);
+				}
+			}
+		}
+	}
+
+	/** Encode a single word.
+	 * @param word The word to encode
+	 * @return The encoding of the word
+	 */
+	std::string
+	encode_word(const Word &word)
+	{
+		std::string buffer;
+		encode_word(word, buffer);
+		return buffer;
+	}
+
+	/** Encode a set of words, e.g., the words of a search tree node, and append it to a buffer.
+	 * @param words The words to encode
+	 * @param buffer The buffer to append the encoding to
+	 */
+	void
+	encode_words(const std::set<Word> &words, std::string &buffer)
+	{
+		utilities::append_varint(words.size(), buffer);
+		// The length of a word is only known after encoding it, so encode each word into a scratch
+		// buffer first. This avoids inserting the length in front of the word, which would move the
+		// word again.
+		std::string word_buffer;
+		for (const auto &word : words) {
+			word_buffer.clear();
+			encode_word(word, word_buffer);
+			utilities::append_varint(word_buffer.size(), buffer);
+			buffer.append(word_buffer);
+		}
+	}
+
+	/** Encode a set of words, e.g., the words of a search tree node.
+	 * @param words The words to encode
+	 * @return The encoding of the set of words
+	 */
+	std::string
+	encode_words(const std::set<Word> &words)
+	{
+		std::string buffer;
+		encode_words(words, buffer);
+		return buffer;
+	}
+
+	/** Decode a single word that has been encoded with this encoder.
+	 * @param encoding The encoding of the word
+	 * @return The decoded word
+	 * @throws std::invalid_argument if the encoding is invalid
+	 */
+	Word
+	decode_word(std::string_view encoding) const
+	{
+		// Each component takes at least one byte for its number of symbols.
+		Word word(details::read_count(encoding, 1));
+		for (auto &component : word) {
+			// Each symbol takes at least one byte for its region index and one for its formula.
+			const auto num_symbols = details::read_count(encoding, 2);
+			for (std::uint64_t i = 0; i < num_symbols; ++i) {
+				const auto        tagged_region = utilities::read_varint(encoding);
+				const RegionIndex region_index  = static_cast<RegionIndex>(tagged_region >> 1);
+				if (tagged_region & 1) {
+					component.insert(ATARegionState<ConstraintSymbolType>{
+					  formulas_.get_symbol(utilities::read_varint(encoding)), region_index});
+				} else {
+					const auto &location = locations_.get_symbol(utilities::read_varint(encoding));
+					const auto &clock    = clocks_.get_symbol(utilities::read_varint(encoding));
+					component.insert(PlantRegionState<Location>{location, clock, region_index});
+				}
+			}
+		}
+		if (!encoding.empty()) {
+			throw std::invalid_argument("Trailing bytes after word encoding");
+		}
+		return word;
+	}
+
+	/** Decode a set of words that has been encoded with this encoder.
+	 * @param encoding The encoding of the set of words
+	 * @return The decoded words
+	 * @throws std::invalid_argument if the encoding is invalid
+	 */
+	std::set<Word>
+	decode_words(std::string_view encoding) const
+	{
+		std::set<Word> words;
+		for (const auto &word : EncodedWordsView{encoding}) {
+			words.insert(decode_word(word));
+		}
+		return words;
+	}
+
+private:
+	SymbolTable<Location>                                locations_;
+	SymbolTable<std::string>                             clocks_;
+	SymbolTable<logic::MTLFormula<ConstraintSymbolType>> formulas_;
+};
+
+} // namespace tacos::search
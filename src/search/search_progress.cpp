@@ -0,0 +1,82 @@
+/***************************************************************************
+ *  search_progress.cpp - Report the progress of a running search
+ *
+ *  Created:   Fri 16 Oct 2026 13:04:31 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#include "search/search_progress.h"
+
+#include <spdlog/spdlog.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+namespace tacos::search {
+
+namespace {
+
+std::string_view
+get_label_name(NodeLabel label)
+{
+	switch (label) {
+	case NodeLabel::UNLABELED: return "UNLABELED";
+	case NodeLabel::BOTTOM: return "BOTTOM";
+	case NodeLabel::TOP: return "TOP";
+	case NodeLabel::CANCELED: return "CANCELED";
+	}
+	return "UNKNOWN";
+}
+
+} // namespace
+
+std::ostream &
+operator<<(std::ostream &os, const SearchProgress &progress)
+{
+	os << "t=" << progress.elapsed.count() << "s, queue: " << progress.queue_size
+	   << ", nodes: " << progress.nodes << ", expanded: " << progress.expanded_nodes
+	   << " (" << progress.nodes_per_second << "/s), labeled: " << progress.labeled_nodes
+	   << ", memory: " << progress.memory_estimate / (1024 * 1024)
+	   << "MiB, root: " << get_label_name(progress.root_label);
+	return os;
+}
+
+std::string
+to_json(const SearchProgress &progress)
+{
+	std::stringstream str;
+	str << R"({"elapsed": )" << progress.elapsed.count() << R"(, "queue_size": )"
+	    << progress.queue_size << R"(, "nodes": )" << progress.nodes << R"(, "expanded_nodes": )"
+	    << progress.expanded_nodes << R"(, "labeled_nodes": )" << progress.labeled_nodes
+	    << R"(, "nodes_per_second": )" << progress.nodes_per_second << R"(, "memory_estimate": )"
+	    << progress.memory_estimate << R"(, "root_label": ")" << get_label_name(progress.root_label)
+	    << R"("})";
+	return str.str();
+}
+
+void
+log_progress(const SearchProgress &progress)
+{
+	std::stringstream str;
+	str << progress;
+	SPDLOG_INFO("Search progress: {}", str.str());
+}
+
+JsonProgressWriter::JsonProgressWriter(const std::filesystem::path &path)
+: stream_(std::make_shared<std::ofstream>(path)), mutex_(std::make_shared<std::mutex>())
+{
+	if (!*stream_) {
+		throw std::invalid_argument("Cannot open progress file '" + path.string() + "'");
+	}
+}
+
+void
+JsonProgressWriter::operator()(const SearchProgress &progress)
+{
+	std::lock_guard lock{*mutex_};
+	*stream_ << to_json(progress) << std::endl;
+}
+
+} // namespace tacos::search
@@ -0,0 +1,66 @@
+/***************************************************************************
+ *  search_statistics.cpp - Statistics collected during the tree search
+ *
+ *  Created:   Fri 16 Oct 2026 12:57:43 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#include "search/search_statistics.h"
+
+namespace tacos::search {
+
+SearchStatistics &
+SearchStatistics::operator+=(const SearchStatistics &other)
+{
+	expanded_nodes += other.expanded_nodes;
+	bad_nodes += other.bad_nodes;
+	good_nodes += other.good_nodes;
+	dead_nodes += other.dead_nodes;
+	domination_prunes += other.domination_prunes;
+	backward_prunes += other.backward_prunes;
+	cancellations += other.cancellations;
+	requeues += other.requeues;
+	discarded_jobs += other.discarded_jobs;
+	successor_cache_hits += other.successor_cache_hits;
+	successor_cache_misses += other.successor_cache_misses;
+	is_bad_node_time += other.is_bad_node_time;
+	dominates_ancestor_time += other.dominates_ancestor_time;
+	time_successors_time += other.time_successors_time;
+	ata_step_time += other.ata_step_time;
+	plant_step_time += other.plant_step_time;
+	nodes_insert_time += other.nodes_insert_time;
+	return *this;
+}
+
+std::ostream &
+operator<<(std::ostream &os, const SearchStatistics &statistics)
+{
+	const auto print_time = [&os](const char *name, const std::chrono::nanoseconds &duration) {
+		os << "\n  " << name << ": "
+		   << std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count()
+		   << "ms";
+	};
+	os << "Expanded nodes: " << statistics.expanded_nodes;
+	os << "\n  bad: " << statistics.bad_nodes << ", good: " << statistics.good_nodes
+	   << ", dead: " << statistics.dead_nodes
+	   << ", dominating an ancestor: " << statistics.domination_prunes
+	   << ", bad configuration unreachable: " << statistics.backward_prunes;
+	os << "\nCanceled jobs: " << statistics.cancellations << ", re-queued nodes: " << statistics.requeues
+	   << ", discarded jobs: " << statistics.discarded_jobs;
+	if (const auto lookups = statistics.successor_cache_hits + statistics.successor_cache_misses;
+	    lookups > 0) {
+		os << "\nPlant successor cache hits: " << statistics.successor_cache_hits << " of " << lookups
+		   << " (" << 100. * statistics.successor_cache_hits / lookups << "%)";
+	}
+	os << "\nTime spent (summed over all threads):";
+	print_time("is_bad_node", statistics.is_bad_node_time);
+	print_time("dominates_ancestor", statistics.dominates_ancestor_time);
+	print_time("time successors", statistics.time_successors_time);
+	print_time("ATA symbol steps", statistics.ata_step_time);
+	print_time("plant symbol steps", statistics.plant_step_time);
+	print_time("node insertion", statistics.nodes_insert_time);
+	return os;
+}
+
+} // namespace tacos::search
@@ -55,6 +55,8 @@ operator<<(std::ostream &os, const search::LabelReason &reason)
 		break;
 	case LabelReason::BAD_ENV_ACTION_FIRST: label_reason = "bad env action first"; break;
 	case LabelReason::ALL_CONTROLLER_ACTIONS_BAD: label_reason = "all ctl actions bad"; break;
+	case LabelReason::UNEXPANDED: label_reason = "not expanded"; break;
+	case LabelReason::BAD_CONFIGURATION_UNREACHABLE: label_reason = "bad config unreachable"; break;
 	}
 	os << label_reason;
 	return os;
@@ -0,0 +1,74 @@
+/***************************************************************************
+ *  addressable_priority_queue.h - A priority queue with priority updates
+ *
+ *  Created:   Fri 16 Oct 2026 13:20:27 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#ifndef SRC_UTILITIES_INCLUDE_UTILITIES_ADDRESSABLE_PRIORITY_QUEUE_H
+#define SRC_UTILITIES_INCLUDE_UTILITIES_ADDRESSABLE_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tacos::utilities {
+
+/** @brief A priority queue that contains each key at most once and allows to update priorities.
+ * The queue is implemented as a binary max-heap together with an index from each key to its
+ * position in the heap. Just like std::priority_queue, the element with the highest priority is at
+ * the top of the queue. The queue is not thread-safe.
+ * @tparam Key The type of the queued elements, must be hashable
+ * @tparam Priority The priority type
+ * @tparam Hash The hash function for the keys
+ */
+template <class Key, class Priority, class Hash = std::hash<Key>>
+class AddressablePriorityQueue
+{
+public:
+	/** Add a key to the queue.
+	 * If the key is already in the queue, it is not added again. Instead, its priority is increased
+	 * if the given priority is higher than its current priority.
+	 * @param key The key to add
+	 * @param priority The priority of the key
+	 * @return true if the key was not in the queue before
+	 */
+	bool push(const Key &key, const Priority &priority);
+	/** Increase the priority of a key that is already in the queue.
+	 * @param key The key to update
+	 * @param priority The new priority, ignored if it is not higher than the current priority
+	 * @return true if the key is in the queue
+	 */
+	bool increase_priority(const Key &key, const Priority &priority);
+	/** Get the element with the highest priority. The queue must not be empty.
+	 * @return A pair (priority, key)
+	 */
+	const std::pair<Priority, Key> &top() const;
+	/** Remove the element with the highest priority. The queue must not be empty. */
+	void pop();
+	/** Check whether the key is in the queue. */
+	bool contains(const Key &key) const;
+	/** Check whether the queue is empty. */
+	bool empty() const;
+	/** Get the number of elements in the queue. */
+	std::size_t size() const;
+	/** Remove all elements from the queue. */
+	void clear();
+
+private:
+	void sift_up(std::size_t position);
+	void sift_down(std::size_t position);
+	void swap_elements(std::size_t position1, std::size_t position2);
+
+	std::vector<std::pair<Priority, Key>>       heap;
+	std::unordered_map<Key, std::size_t, Hash> positions;
+};
+
+} // namespace tacos::utilities
+
+#include "addressable_priority_queue.hpp"
+
+#endif /* ifndef SRC_UTILITIES_INCLUDE_UTILITIES_ADDRESSABLE_PRIORITY_QUEUE_H */
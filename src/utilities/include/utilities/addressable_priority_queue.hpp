@@ -0,0 +1,146 @@
+/***************************************************************************
+ *  addressable_priority_queue.hpp - A priority queue with priority updates
+ *
+ *  Created:   Fri 16 Oct 2026 13:20:27 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include "addressable_priority_queue.h"
+
+#include <stdexcept>
+
+namespace tacos::utilities {
+
+template <class Key, class Priority, class Hash>
+bool
+AddressablePriorityQueue<Key, Priority, Hash>::push(const Key &key, const Priority &priority)
+{
+	if (increase_priority(key, priority)) {
+		return false;
+	}
+	heap.emplace_back(priority, key);
+	positions[key] = heap.size() - 1;
+	sift_up(heap.size() - 1);
+	return true;
+}
+
+template <class Key, class Priority, class Hash>
+bool
+AddressablePriorityQueue<Key, Priority, Hash>::increase_priority(const Key      &key,
+                                                                 const Priority &priority)
+{
+	const auto position = positions.find(key);
+	if (position == std::end(positions)) {
+		return false;
+	}
+	if (heap[position->second].first < priority) {
+		heap[position->second].first = priority;
+		sift_up(position->second);
+	}
+	return true;
+}
+
+template <class Key, class Priority, class Hash>
+const std::pair<Priority, Key> &
+AddressablePriorityQueue<Key, Priority, Hash>::top() const
+{
+	if (heap.empty()) {
+		throw std::out_of_range("Cannot access the top of an empty queue");
+	}
+	return heap.front();
+}
+
+template <class Key, class Priority, class Hash>
+void
+AddressablePriorityQueue<Key, Priority, Hash>::pop()
+{
+	if (heap.empty()) {
+		throw std::out_of_range("Cannot pop from an empty queue");
+	}
+	swap_elements(0, heap.size() - 1);
+	positions.erase(heap.back().second);
+	heap.pop_back();
+	if (!heap.empty()) {
+		sift_down(0);
+	}
+}
+
+template <class Key, class Priority, class Hash>
+bool
+AddressablePriorityQueue<Key, Priority, Hash>::contains(const Key &key) const
+{
+	return positions.find(key) != std::end(positions);
+}
+
+template <class Key, class Priority, class Hash>
+bool
+AddressablePriorityQueue<Key, Priority, Hash>::empty() const
+{
+	return heap.empty();
+}
+
+template <class Key, class Priority, class Hash>
+std::size_t
+AddressablePriorityQueue<Key, Priority, Hash>::size() const
+{
+	return heap.size();
+}
+
+template <class Key, class Priority, class Hash>
+void
+AddressablePriorityQueue<Key, Priority, Hash>::clear()
+{
+	heap.clear();
+	positions.clear();
+}
+
+template <class Key, class Priority, class Hash>
+void
+AddressablePriorityQueue<Key, Priority, Hash>::sift_up(std::size_t position)
+{
+	while (position > 0) {
+		const std::size_t parent = (position - 1) / 2;
+		if (!(heap[parent].first < heap[position].first)) {
+			return;
+		}
+		swap_elements(parent, position);
+		position = parent;
+	}
+}
+
+template <class Key, class Priority, class Hash>
+void
+AddressablePriorityQueue<Key, Priority, Hash>::sift_down(std::size_t position)
+{
+	while (true) {
+		const std::size_t left    = 2 * position + 1;
+		const std::size_t right   = left + 1;
+		std::size_t       largest = position;
+		if (left < heap.size() && heap[largest].first < heap[left].first) {
+			largest = left;
+		}
+		if (right < heap.size() && heap[largest].first < heap[right].first) {
+			largest = right;
+		}
+		if (largest == position) {
+			return;
+		}
+		swap_elements(position, largest);
+		position = largest;
+	}
+}
+
+template <class Key, class Priority, class Hash>
+void
+AddressablePriorityQueue<Key, Priority, Hash>::swap_elements(std::size_t position1,
+                                                             std::size_t position2)
+{
+	std::swap(heap[position1], heap[position2]);
+	positions[heap[position1].second] = position1;
+	positions[heap[position2].second] = position2;
+}
+
+} // namespace tacos::utilities
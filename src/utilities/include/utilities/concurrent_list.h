@@ -0,0 +1,124 @@
+/***************************************************************************
+ *  concurrent_list.h - A lock-free list that only grows
+ *
+ *  Created:   Fri 16 Oct 2026 13:40:17 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#ifndef SRC_UTILITIES_INCLUDE_UTILITIES_CONCURRENT_LIST_H
+#define SRC_UTILITIES_INCLUDE_UTILITIES_CONCURRENT_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+
+namespace tacos::utilities {
+
+/** @brief A singly-linked list that allows concurrent insertion and iteration without locks.
+ * Elements can only be added to the front of the list, they are never removed before the list is
+ * destroyed. Thus, an iterator stays valid while other threads add elements. An iteration visits
+ * all elements that have been added before the iteration has started, elements added concurrently
+ * may or may not be visited.
+ * @tparam T The type of the elements
+ */
+template <class T>
+class ConcurrentList
+{
+	struct Element
+	{
+		T        value;
+		Element *next;
+	};
+
+public:
+	/** @brief A forward iterator over the elements of the list. */
+	class const_iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type        = T;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = const T *;
+		using reference         = const T &;
+
+		/** Construct an iterator pointing to the given element, or the end if it is nullptr. */
+		explicit const_iterator(const Element *element = nullptr) : element(element)
+		{
+		}
+		/** Access the current element. */
+		reference
+		operator*() const
+		{
+			return element->value;
+		}
+		/** Access the current element. */
+		pointer
+		operator->() const
+		{
+			return &element->value;
+		}
+		/** Advance to the next element. */
+		const_iterator &
+		operator++()
+		{
+			element = element->next;
+			return *this;
+		}
+		/** Advance to the next element and return the previous position. */
+		const_iterator
+		operator++(int)
+		{
+			const_iterator previous{*this};
+			++*this;
+			return previous;
+		}
+		/** Compare two iterators. */
+		bool
+		operator==(const const_iterator &other) const
+		{
+			return element == other.element;
+		}
+		/** Compare two iterators. */
+		bool
+		operator!=(const const_iterator &other) const
+		{
+			return element != other.element;
+		}
+
+	private:
+		const Element *element;
+	};
+
+	/** Construct an empty list. */
+	ConcurrentList() = default;
+	/** Construct a list with the given elements. */
+	ConcurrentList(std::initializer_list<T> values);
+	ConcurrentList(const ConcurrentList &)            = delete;
+	ConcurrentList &operator=(const ConcurrentList &) = delete;
+	/** Destroy the list and all its elements. This must not run concurrently with other accesses. */
+	~ConcurrentList();
+
+	/** Add an element to the front of the list. This may be called concurrently. */
+	void push_front(const T &value);
+	/** Check whether the list contains the given value. */
+	bool contains(const T &value) const;
+	/** Check whether the list is empty. */
+	bool empty() const;
+	/** Get the number of elements in the list. This iterates over the whole list. */
+	std::size_t size() const;
+	/** Get an iterator to the first element. */
+	const_iterator begin() const;
+	/** Get the end iterator. */
+	const_iterator end() const;
+
+private:
+	std::atomic<Element *> head{nullptr};
+};
+
+} // namespace tacos::utilities
+
+#include "concurrent_list.hpp"
+
+#endif /* ifndef SRC_UTILITIES_INCLUDE_UTILITIES_CONCURRENT_LIST_H */
@@ -0,0 +1,83 @@
+/***************************************************************************
+ *  concurrent_list.hpp - A lock-free list that only grows
+ *
+ *  Created:   Fri 16 Oct 2026 13:40:17 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include "concurrent_list.h"
+
+#include <algorithm>
+
+namespace tacos::utilities {
+
+template <class T>
+ConcurrentList<T>::ConcurrentList(std::initializer_list<T> values)
+{
+	for (const auto &value : values) {
+		push_front(value);
+	}
+}
+
+template <class T>
+ConcurrentList<T>::~ConcurrentList()
+{
+	Element *element = head.load(std::memory_order_acquire);
+	while (element != nullptr) {
+		Element *next = element->next;
+		delete element;
+		element = next;
+	}
+}
+
+template <class T>
+void
+ConcurrentList<T>::push_front(const T &value)
+{
+	auto element = new Element{value, head.load(std::memory_order_relaxed)};
+	// On failure, element->next is updated to the current head and we try again.
+	while (!head.compare_exchange_weak(element->next,
+	                                   element,
+	                                   std::memory_order_release,
+	                                   std::memory_order_relaxed)) {}
+}
+
+template <class T>
+bool
+ConcurrentList<T>::contains(const T &value) const
+{
+	return std::find(begin(), end(), value) != end();
+}
+
+template <class T>
+bool
+ConcurrentList<T>::empty() const
+{
+	return head.load(std::memory_order_acquire) == nullptr;
+}
+
+template <class T>
+std::size_t
+ConcurrentList<T>::size() const
+{
+	return std::distance(begin(), end());
+}
+
+template <class T>
+typename ConcurrentList<T>::const_iterator
+ConcurrentList<T>::begin() const
+{
+	return const_iterator{head.load(std::memory_order_acquire)};
+}
+
+template <class T>
+typename ConcurrentList<T>::const_iterator
+ConcurrentList<T>::end() const
+{
+	return const_iterator{};
+}
+
+} // namespace tacos::utilities
@@ -0,0 +1,122 @@
+/***************************************************************************
+ *  cpu_topology.h - Query the NUMA nodes and pin threads to CPUs
+ *
+ *  Created:   Fri 16 Oct 2026 14:04:30 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#ifndef SRC_UTILITIES_INCLUDE_UTILITIES_CPU_TOPOLOGY_H
+#define SRC_UTILITIES_INCLUDE_UTILITIES_CPU_TOPOLOGY_H
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#	include <pthread.h>
+#	include <sched.h>
+#endif
+
+namespace tacos::utilities {
+
+/** Parse a list of CPUs in the format used by Linux, e.g., "0-3,8,10-11".
+ * @param cpu_list The list to parse
+ * @return The CPU indexes in the list
+ */
+inline std::vector<unsigned int>
+parse_cpu_list(const std::string &cpu_list)
+{
+	std::vector<unsigned int> cpus;
+	std::stringstream         stream{cpu_list};
+	std::string               range;
+	while (std::getline(stream, range, ',')) {
+		range.erase(std::remove_if(std::begin(range), std::end(range), ::isspace), std::end(range));
+		if (range.empty()) {
+			continue;
+		}
+		const auto         separator = range.find('-');
+		const unsigned int first     = std::stoul(range.substr(0, separator));
+		const unsigned int last =
+		  separator == std::string::npos ? first : std::stoul(range.substr(separator + 1));
+		if (last < first) {
+			throw std::invalid_argument("Invalid CPU range '" + range + "'");
+		}
+		for (unsigned int cpu = first; cpu <= last; ++cpu) {
+			cpus.push_back(cpu);
+		}
+	}
+	return cpus;
+}
+
+/** Get the CPUs of each NUMA node of the machine.
+ * On Linux, the topology is read from sysfs. If it is not available, all CPUs are considered to be
+ * on a single node.
+ * @return The CPUs of each NUMA node, ordered by the node index
+ */
+inline std::vector<std::vector<unsigned int>>
+get_numa_nodes()
+{
+	std::map<unsigned int, std::vector<unsigned int>> nodes;
+	const std::filesystem::path                       node_dir{"/sys/devices/system/node"};
+	std::error_code                                   error;
+	for (const auto &entry : std::filesystem::directory_iterator(node_dir, error)) {
+		const std::string name = entry.path().filename().string();
+		if (name.rfind("node", 0) != 0 || name.size() == 4
+		    || !std::all_of(std::begin(name) + 4, std::end(name), ::isdigit)) {
+			continue;
+		}
+		std::ifstream cpu_list_file{entry.path() / "cpulist"};
+		std::string   cpu_list;
+		if (std::getline(cpu_list_file, cpu_list)) {
+			if (auto cpus = parse_cpu_list(cpu_list); !cpus.empty()) {
+				nodes[std::stoul(name.substr(4))] = std::move(cpus);
+			}
+		}
+	}
+	std::vector<std::vector<unsigned int>> result;
+	for (auto &[index, cpus] : nodes) {
+		result.push_back(std::move(cpus));
+	}
+	if (result.empty()) {
+		std::vector<unsigned int> cpus(std::max(1u, std::thread::hardware_concurrency()));
+		for (unsigned int cpu = 0; cpu < cpus.size(); ++cpu) {
+			cpus[cpu] = cpu;
+		}
+		result.push_back(std::move(cpus));
+	}
+	return result;
+}
+
+/** Restrict the calling thread to the given CPUs.
+ * @param cpus The CPUs the thread may run on
+ * @return true if the affinity has been set, false if it is not supported or failed
+ */
+inline bool
+pin_current_thread(const std::vector<unsigned int> &cpus)
+{
+#ifdef __linux__
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (const auto cpu : cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+	(void)cpus;
+	return false;
+#endif
+}
+
+} // namespace tacos::utilities
+
+#endif /* ifndef SRC_UTILITIES_INCLUDE_UTILITIES_CPU_TOPOLOGY_H */
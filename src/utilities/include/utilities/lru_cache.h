@@ -0,0 +1,78 @@
+/***************************************************************************
+ *  lru_cache.h - A thread-safe cache with least-recently-used eviction
+ *
+ *  Created:   Fri 16 Oct 2026 14:45:32 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#ifndef SRC_UTILITIES_INCLUDE_UTILITIES_LRU_CACHE_H
+#define SRC_UTILITIES_INCLUDE_UTILITIES_LRU_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace tacos::utilities {
+
+/** @brief A cache with a fixed capacity that evicts the least recently used entry.
+ * All methods may be called concurrently. The values are shared with the callers, so a value stays
+ * valid even if it is evicted while it is being used. The cache counts hits and misses of all
+ * lookups.
+ * @tparam Key The type of the keys, must be comparable with <
+ * @tparam Value The type of the cached values
+ */
+template <class Key, class Value>
+class LruCache
+{
+public:
+	/** Construct an empty cache.
+	 * @param capacity The maximal number of entries, must be positive
+	 * @throws std::invalid_argument if the capacity is zero
+	 */
+	explicit LruCache(std::size_t capacity);
+
+	/** Look up a value and mark it as most recently used.
+	 * @param key The key to look up
+	 * @return The cached value, or nullptr if the key is not cached
+	 */
+	std::shared_ptr<const Value> get(const Key &key);
+	/** Add a value to the cache, evicting the least recently used entry if the cache is full.
+	 * If the key is already cached, its value is replaced.
+	 * @param key The key of the value
+	 * @param value The value to cache
+	 * @return The cached value
+	 */
+	std::shared_ptr<const Value> put(const Key &key, Value value);
+	/** Get the number of cached entries. */
+	std::size_t size() const;
+	/** Get the maximal number of cached entries. */
+	std::size_t get_capacity() const;
+	/** Get the number of lookups that found a cached value. */
+	std::size_t get_hits() const;
+	/** Get the number of lookups that did not find a cached value. */
+	std::size_t get_misses() const;
+	/** Get the ratio of lookups that found a cached value, or 0 if there was no lookup. */
+	double get_hit_rate() const;
+
+private:
+	using Entry = std::pair<Key, std::shared_ptr<const Value>>;
+
+	const std::size_t  capacity;
+	mutable std::mutex mutex;
+	/** The entries, ordered from the most to the least recently used one. */
+	std::list<Entry>                                   entries;
+	std::map<Key, typename std::list<Entry>::iterator> positions;
+	std::atomic<std::size_t>                           hits{0};
+	std::atomic<std::size_t>                           misses{0};
+};
+
+} // namespace tacos::utilities
+
+#include "lru_cache.hpp"
+
+#endif /* ifndef SRC_UTILITIES_INCLUDE_UTILITIES_LRU_CACHE_H */
@@ -0,0 +1,97 @@
+/***************************************************************************
+ *  lru_cache.hpp - A thread-safe cache with least-recently-used eviction
+ *
+ *  Created:   Fri 16 Oct 2026 14:45:32 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#pragma once
+
+#include "lru_cache.h"
+
+#include <stdexcept>
+
+namespace tacos::utilities {
+
+template <class Key, class Value>
+LruCache<Key, Value>::LruCache(std::size_t capacity) : capacity(capacity)
+{
+	if (capacity == 0) {
+		throw std::invalid_argument("The capacity of a cache must be positive");
+	}
+}
+
+template <class Key, class Value>
+std::shared_ptr<const Value>
+LruCache<Key, Value>::get(const Key &key)
+{
+	std::lock_guard lock{mutex};
+	const auto      position = positions.find(key);
+	if (position == std::end(positions)) {
+		++misses;
+		return nullptr;
+	}
+	++hits;
+	entries.splice(std::begin(entries), entries, position->second);
+	return position->second->second;
+}
+
+template <class Key, class Value>
+std::shared_ptr<const Value>
+LruCache<Key, Value>::put(const Key &key, Value value)
+{
+	auto            shared_value = std::make_shared<const Value>(std::move(value));
+	std::lock_guard lock{mutex};
+	if (const auto position = positions.find(key); position != std::end(positions)) {
+		position->second->second = shared_value;
+		entries.splice(std::begin(entries), entries, position->second);
+		return shared_value;
+	}
+	if (entries.size() >= capacity) {
+		positions.erase(entries.back().first);
+		entries.pop_back();
+	}
+	entries.emplace_front(key, shared_value);
+	positions.emplace(key, std::begin(entries));
+	return shared_value;
+}
+
+template <class Key, class Value>
+std::size_t
+LruCache<Key, Value>::size() const
+{
+	std::lock_guard lock{mutex};
+	return entries.size();
+}
+
+template <class Key, class Value>
+std::size_t
+LruCache<Key, Value>::get_capacity() const
+{
+	return capacity;
+}
+
+template <class Key, class Value>
+std::size_t
+LruCache<Key, Value>::get_hits() const
+{
+	return hits;
+}
+
+template <class Key, class Value>
+std::size_t
+LruCache<Key, Value>::get_misses() const
+{
+	return misses;
+}
+
+template <class Key, class Value>
+double
+LruCache<Key, Value>::get_hit_rate() const
+{
+	const std::size_t lookups = hits + misses;
+	return lookups == 0 ? 0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+} // namespace tacos::utilities
@@ -12,11 +12,13 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <mutex>
 #include <queue>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace tacos::utilities {
 
@@ -59,12 +61,19 @@ public:
 		NO,
 		YES,
 	};
+	/** Where the workers of the pool may run. */
+	enum class Affinity {
+		NONE, /**< The workers are not pinned, the OS schedules them on any CPU. */
+		NUMA, /**< The workers are distributed round-robin over the NUMA nodes and pinned to them. */
+	};
 	/** Construct a thread pool.
 	 * @param start Whether the pool shall be started on initialization
 	 * @param num_threads The number of threads in the pool
+	 * @param affinity Whether the workers shall be pinned to NUMA nodes
 	 */
 	ThreadPool(StartOnInit start       = StartOnInit::YES,
-	           std::size_t num_threads = std::thread::hardware_concurrency());
+	           std::size_t num_threads = std::thread::hardware_concurrency(),
+	           Affinity    affinity    = Affinity::NONE);
 	/** Stop and destruct the pool. This will stop all workers. */
 	virtual ~ThreadPool();
 	/** Add a job to the pool.
@@ -87,9 +96,35 @@ public:
 	void wait();
 	/** Close the queue and let the workers finish all jobs. */
 	void finish();
+	/** Get the number of jobs waiting in the queue.
+	 * In contrast to QueueAccess::get_size, this may also be called while the pool is running.
+	 * @return The number of jobs that have not been started yet
+	 */
+	std::size_t get_queue_size();
+	/** Remove all jobs from the queue without running them.
+	 * Jobs that are currently running are not affected. In contrast to cancel(), this may be called
+	 * from within a job and the pool can still be used afterwards.
+	 * @return The number of removed jobs
+	 */
+	std::size_t clear_queue();
+	/** Get the number of domains the workers are distributed over.
+	 * With Affinity::NUMA, this is the number of NUMA nodes, otherwise all workers are in a single
+	 * domain.
+	 */
+	std::size_t get_num_domains() const;
+	/** Get the domain of the calling thread.
+	 * @return The index of the NUMA node the calling worker is pinned to, or 0 if the calling thread
+	 * is not a pinned worker of this pool
+	 */
+	std::size_t get_current_domain() const;
 
 private:
-	std::size_t              size;
+	std::size_t                            size;
+	std::vector<std::vector<unsigned int>> domains;
+	/** The pool of the calling worker thread, or nullptr if the thread is not a pinned worker. */
+	static inline thread_local const ThreadPool *current_pool{nullptr};
+	/** The domain of the calling worker thread within current_pool. */
+	static inline thread_local std::size_t current_domain{0};
 	bool                     started{false};
 	std::vector<std::thread> workers;
 	std::priority_queue<std::pair<Priority, T>,
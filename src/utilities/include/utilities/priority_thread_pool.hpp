@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "cpu_topology.h"
 #include "priority_thread_pool.h"
 
 #include <mutex>
@@ -28,8 +29,12 @@ class QueueStartedException : public std::logic_error
 };
 
 template <class Priority, class T>
-ThreadPool<Priority, T>::ThreadPool(StartOnInit start_on_init, std::size_t size) : size(size)
+ThreadPool<Priority, T>::ThreadPool(StartOnInit start_on_init, std::size_t size, Affinity affinity)
+: size(size)
 {
+	if (affinity == Affinity::NUMA) {
+		domains = get_numa_nodes();
+	}
 	if (start_on_init == StartOnInit::YES) {
 		start();
 	}
@@ -45,6 +50,11 @@ ThreadPool<Priority, T>::start()
 	worker_idle = std::vector(size, false);
 	for (std::size_t i = 0; i < size; ++i) {
 		workers.push_back(std::thread{[this, i]() {
+			if (!domains.empty()) {
+				current_pool   = this;
+				current_domain = i % domains.size();
+				pin_current_thread(domains[current_domain]);
+			}
 			while (!stopping) {
 				{
 					std::lock_guard idle_guard{worker_idle_mutex};
@@ -83,6 +93,20 @@ ThreadPool<Priority, T>::~ThreadPool()
 	cancel();
 }
 
+template <class Priority, class T>
+std::size_t
+ThreadPool<Priority, T>::get_num_domains() const
+{
+	return domains.empty() ? 1 : domains.size();
+}
+
+template <class Priority, class T>
+std::size_t
+ThreadPool<Priority, T>::get_current_domain() const
+{
+	return current_pool == this ? current_domain : 0;
+}
+
 template <class Priority, class T>
 void
 ThreadPool<Priority, T>::add_job(std::pair<Priority, T> &&job)
@@ -140,6 +164,24 @@ ThreadPool<Priority, T>::finish()
 	}
 }
 
+template <class Priority, class T>
+std::size_t
+ThreadPool<Priority, T>::get_queue_size()
+{
+	std::lock_guard guard{queue_mutex};
+	return queue.size();
+}
+
+template <class Priority, class T>
+std::size_t
+ThreadPool<Priority, T>::clear_queue()
+{
+	std::lock_guard guard{queue_mutex};
+	const std::size_t num_jobs = queue.size();
+	queue                      = decltype(queue){};
+	return num_jobs;
+}
+
 template <class Priority, class T>
 void
 ThreadPool<Priority, T>::cancel()
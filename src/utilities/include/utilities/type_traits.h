@@ -18,4 +18,15 @@ struct values_equal : std::bool_constant<V1 == V2>
 	using type = T;
 };
 
+// Taken from https://en.cppreference.com/w/cpp/types/type_identity, which is only part of C++20.
+// type_identity_t<T> is T, but it is not deduced in template argument deduction.
+template <typename T>
+struct type_identity
+{
+	using type = T;
+};
+
+template <typename T>
+using type_identity_t = typename type_identity<T>::type;
+
 } // namespace tacos::utilities
@@ -0,0 +1,60 @@
+/***************************************************************************
+ *  varint.h - Variable-length encoding of unsigned integers
+ *
+ *  Created:   Fri 16 Oct 2026 14:12:21 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#ifndef SRC_UTILITIES_INCLUDE_UTILITIES_VARINT_H
+#define SRC_UTILITIES_INCLUDE_UTILITIES_VARINT_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace tacos::utilities {
+
+/** Append an unsigned integer in the LEB128 varint format to a buffer.
+ * Each byte holds seven bits of the value, starting with the least significant bits. The highest
+ * bit of each byte is set if more bytes follow. Small values thus only need a single byte.
+ * @param value The value to encode
+ * @param buffer The buffer to append to
+ */
+inline void
+append_varint(std::uint64_t value, std::string &buffer)
+{
+	while (value >= 0x80) {
+		buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+	buffer.push_back(static_cast<char>(value));
+}
+
+/** Read an unsigned integer in the LEB128 varint format from the front of a buffer.
+ * @param buffer The buffer to read from, the read bytes are removed from the view
+ * @return The decoded value
+ * @throws std::invalid_argument if the buffer ends before the value is complete
+ */
+inline std::uint64_t
+read_varint(std::string_view &buffer)
+{
+	std::uint64_t value = 0;
+	for (unsigned int shift = 0; shift < 64; shift += 7) {
+		if (buffer.empty()) {
+			throw std::invalid_argument("Truncated varint");
+		}
+		const auto byte = static_cast<unsigned char>(buffer.front());
+		buffer.remove_prefix(1);
+		value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0) {
+			return value;
+		}
+	}
+	throw std::invalid_argument("Varint too long");
+}
+
+} // namespace tacos::utilities
+
+#endif /* ifndef SRC_UTILITIES_INCLUDE_UTILITIES_VARINT_H */
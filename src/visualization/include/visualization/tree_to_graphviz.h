@@ -9,21 +9,38 @@
 #pragma once
 
 #include <search/search_tree.h>
+#include <search/word_encoding.h>
 #include <utilities/graphviz/graphviz.h>
 
 #include <optional>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace tacos::visualization {
 
 using search::LabelReason;
 
+/** @brief The graph nodes that have already been added, indexed by the encoding of their words.
+ * This allows to look up a node without building its label.
+ */
+template <typename LocationT, typename ConstraintSymbolT>
+struct GraphNodeCache
+{
+	/** The encoder for the words of the search nodes */
+	search::WordEncoder<LocationT, ConstraintSymbolT> encoder;
+	/** The graph nodes, indexed by the encoding of their words */
+	std::unordered_map<std::string, utilities::graphviz::Node> nodes;
+};
+
 /** @brief Add a search tree node to a dot graph visualization of the search tree.
  * Add node as dot node to thegraph. Additionally, add all its children along
  * with edges from the given node to its children.
  * @param search_node The node to add to the graph
  * @param graph The graph to add the node to
+ * @param node_selector Only add the nodes for which the selector returns true
+ * @param cache The nodes that have already been added to the graph, if nullptr, a new cache is used
  * @return The graphviz node, which can be used as reference for adding additional edges.
  */
 template <typename LocationT, typename ActionT, typename ConstraintSymbolT>
@@ -32,11 +49,21 @@ add_search_node_to_graph(
   const search::SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> *search_node,
   utilities::graphviz::Graph                                          *graph,
   std::function<bool(const search::SearchTreeNode<LocationT, ActionT, ConstraintSymbolT> &)>
-    node_selector)
+    node_selector,
+  GraphNodeCache<LocationT, ConstraintSymbolT> *cache = nullptr)
 {
 	if (!node_selector(*search_node)) {
 		return std::nullopt;
 	}
+	if (cache == nullptr) {
+		GraphNodeCache<LocationT, ConstraintSymbolT> local_cache;
+		return add_search_node_to_graph(search_node, graph, node_selector, &local_cache);
+	}
+	// Only build the label strings if we have not seen the node before.
+	const std::string encoded_words = cache->encoder.encode_words(search_node->words);
+	if (auto cached_node = cache->nodes.find(encoded_words); cached_node != std::end(cache->nodes)) {
+		return cached_node->second;
+	}
 	std::vector<std::string> words_labels;
 	for (const auto &word : search_node->words) {
 		std::vector<std::string> word_labels;
@@ -64,25 +91,23 @@ add_search_node_to_graph(
 		break;
 	case LabelReason::BAD_ENV_ACTION_FIRST: label_reason = "bad env action first"; break;
 	case LabelReason::ALL_CONTROLLER_ACTIONS_BAD: label_reason = "all ctl actions bad"; break;
+	case LabelReason::UNEXPANDED: label_reason = "not expanded"; break;
+	case LabelReason::BAD_CONFIGURATION_UNREACHABLE: label_reason = "bad config unreachable"; break;
 	}
-	const std::string         node_id  = fmt::format("{}", fmt::join(words_labels, "|"));
-	const bool                new_node = !graph->has_node(node_id);
-	utilities::graphviz::Node node     = graph->get_node(node_id).value_or(
-    graph->add_node(fmt::format("{{{}}}|{}", label_reason, fmt::join(words_labels, "|")), node_id));
+	const std::string         node_id = fmt::format("{}", fmt::join(words_labels, "|"));
+	utilities::graphviz::Node node    = graph->add_node(
+    fmt::format("{{{}}}|{}", label_reason, fmt::join(words_labels, "|")), node_id);
+	cache->nodes.emplace(encoded_words, node);
 	// Set the node color according to its label.
 	if (search_node->label == search::NodeLabel::TOP) {
 		node.set_property("color", "green");
 	} else if (search_node->label == search::NodeLabel::BOTTOM) {
 		node.set_property("color", "red");
 	}
-	if (new_node) {
-		for (const auto &[action, child] : search_node->get_children()) {
-			auto graphviz_child = add_search_node_to_graph(child.get(), graph, node_selector);
-			if (graphviz_child) {
-				graph->add_edge(node,
-				                *graphviz_child,
-				                fmt::format("({}, {})", action.first, action.second));
-			}
+	for (const auto &[action, child] : search_node->get_children()) {
+		auto graphviz_child = add_search_node_to_graph(child.get(), graph, node_selector, cache);
+		if (graphviz_child) {
+			graph->add_edge(node, *graphviz_child, fmt::format("({}, {})", action.first, action.second));
 		}
 	}
 	return node;
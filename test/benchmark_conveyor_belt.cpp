@@ -126,14 +126,13 @@ BM_ConveyorBelt(benchmark::State &state, bool weighted = true, bool multi_thread
 		                                                          environment_actions,
 		                                                          K);
 		tree_size += search.get_size();
-		std::for_each(std::begin(search.get_nodes()),
-		              std::end(search.get_nodes()),
-		              [&pruned_tree_size](const auto &node) {
-			              if (node.second->label != search::NodeLabel::CANCELED
-			                  && node.second->label != search::NodeLabel::UNLABELED) {
-				              pruned_tree_size += 1;
-			              }
-		              });
+		const auto nodes = search.get_nodes();
+		std::for_each(std::begin(nodes), std::end(nodes), [&pruned_tree_size](const auto &node) {
+			if (node->label != search::NodeLabel::CANCELED
+			    && node->label != search::NodeLabel::UNLABELED) {
+				pruned_tree_size += 1;
+			}
+		});
 		plant_size += plant.get_locations().size();
 		controller_size += controller.get_locations().size();
 	}
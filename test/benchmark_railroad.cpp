@@ -122,14 +122,13 @@ BM_Railroad(benchmark::State &state, Mode mode, bool multi_threaded = true)
 		search.label();
 		plant_size += plant.get_locations().size();
 		tree_size += search.get_size();
-		std::for_each(std::begin(search.get_nodes()),
-		              std::end(search.get_nodes()),
-		              [&pruned_tree_size](const auto &node) {
-			              if (node.second->label != search::NodeLabel::CANCELED
-			                  && node.second->label != search::NodeLabel::UNLABELED) {
-				              pruned_tree_size += 1;
-			              }
-		              });
+		const auto nodes = search.get_nodes();
+		std::for_each(std::begin(nodes), std::end(nodes), [&pruned_tree_size](const auto &node) {
+			if (node->label != search::NodeLabel::CANCELED
+			    && node->label != search::NodeLabel::UNLABELED) {
+				pruned_tree_size += 1;
+			}
+		});
 		auto controller = controller_synthesis::create_controller(
 		  search.get_root(), controller_actions, environment_actions, K, true);
 		controller_size += controller.get_locations().size();
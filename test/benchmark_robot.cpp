@@ -140,14 +140,13 @@ BM_Robot(benchmark::State &state, bool weighted = true, bool multi_threaded = tr
 		search.build_tree(multi_threaded);
 		search.label();
 		tree_size += search.get_size();
-		std::for_each(std::begin(search.get_nodes()),
-		              std::end(search.get_nodes()),
-		              [&pruned_tree_size](const auto &node) {
-			              if (node.second->label != search::NodeLabel::CANCELED
-			                  && node.second->label != search::NodeLabel::UNLABELED) {
-				              pruned_tree_size += 1;
-			              }
-		              });
+		const auto nodes = search.get_nodes();
+		std::for_each(std::begin(nodes), std::end(nodes), [&pruned_tree_size](const auto &node) {
+			if (node->label != search::NodeLabel::CANCELED
+			    && node->label != search::NodeLabel::UNLABELED) {
+				pruned_tree_size += 1;
+			}
+		});
 		plant_size += product.get_locations().size();
 		auto controller =
 		  controller_synthesis::create_controller(search.get_root(), camera_actions, robot_actions, K);
@@ -0,0 +1,77 @@
+/***************************************************************************
+ *  test_addressable_priority_queue.cpp - Test the addressable priority queue
+ *
+ *  Created:   Fri 16 Oct 2026 13:20:27 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#include "utilities/addressable_priority_queue.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace tacos;
+
+using utilities::AddressablePriorityQueue;
+
+TEST_CASE("Push and pop elements of an addressable priority queue", "[queue]")
+{
+	AddressablePriorityQueue<std::string, int> queue;
+	CHECK(queue.empty());
+	CHECK(queue.push("a", 1));
+	CHECK(queue.push("b", 5));
+	CHECK(queue.push("c", 3));
+	CHECK(queue.push("d", 0));
+	CHECK(queue.size() == 4);
+	CHECK(queue.contains("a"));
+	CHECK(!queue.contains("e"));
+	std::vector<std::string> order;
+	while (!queue.empty()) {
+		order.push_back(queue.top().second);
+		queue.pop();
+	}
+	CHECK(order == std::vector<std::string>{"b", "c", "a", "d"});
+	CHECK(!queue.contains("a"));
+	CHECK_THROWS_AS(queue.top(), std::out_of_range);
+	CHECK_THROWS_AS(queue.pop(), std::out_of_range);
+}
+
+TEST_CASE("Update priorities in an addressable priority queue", "[queue]")
+{
+	AddressablePriorityQueue<std::string, int> queue;
+	queue.push("a", 1);
+	queue.push("b", 2);
+	queue.push("c", 3);
+	SECTION("Each key is only added once")
+	{
+		CHECK(!queue.push("a", 0));
+		CHECK(queue.size() == 3);
+		CHECK(queue.top() == std::make_pair(3, std::string{"c"}));
+	}
+	SECTION("Pushing an existing key increases its priority")
+	{
+		CHECK(!queue.push("a", 4));
+		CHECK(queue.size() == 3);
+		CHECK(queue.top() == std::make_pair(4, std::string{"a"}));
+	}
+	SECTION("Increase the priority of a queued key")
+	{
+		CHECK(queue.increase_priority("b", 5));
+		CHECK(queue.top() == std::make_pair(5, std::string{"b"}));
+		// A lower priority is ignored.
+		CHECK(queue.increase_priority("b", 0));
+		CHECK(queue.top() == std::make_pair(5, std::string{"b"}));
+		CHECK(!queue.increase_priority("d", 10));
+		CHECK(!queue.contains("d"));
+	}
+	SECTION("Clear the queue")
+	{
+		queue.clear();
+		CHECK(queue.empty());
+		CHECK(!queue.contains("a"));
+		CHECK(queue.push("a", 1));
+	}
+}
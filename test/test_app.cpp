@@ -54,7 +54,7 @@ TEST_CASE("Launch the main application", "[app]")
 	}
 	SECTION("Select heuristics")
 	{
-		for (const auto &heuristic : {"bfs", "dfs", "composite", "random", "time"}) {
+		for (const auto &heuristic : {"bfs", "dfs", "composite", "random", "time", "distance"}) {
 			const std::array argv{
 			  "app",
 			  "--single-threaded",
@@ -71,6 +71,207 @@ TEST_CASE("Launch the main application", "[app]")
 			CHECK_NOTHROW(launcher.run());
 		}
 	}
+	SECTION("Prune nodes with a backward analysis")
+	{
+		const std::array argv{
+		  "app",
+		  "--single-threaded",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		  "--backward-pruning",
+		};
+		tacos::app::Launcher launcher{argv.size(), argv.data()};
+		CHECK_NOTHROW(launcher.run());
+	}
+	SECTION("Run a portfolio search")
+	{
+		const std::array argv{
+		  "app",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		  "--portfolio",
+		  "bfs",
+		  "dfs",
+		  "composite",
+		};
+		tacos::app::Launcher launcher{argv.size(), argv.data()};
+		CHECK_NOTHROW(launcher.run());
+	}
+	SECTION("Precompute the plant region graph")
+	{
+		const std::array plain_argv{
+		  "app",
+		  "--single-threaded",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		};
+		tacos::app::Launcher plain_launcher{plain_argv.size(), plain_argv.data()};
+		CHECK_NOTHROW(plain_launcher.run());
+		const std::array argv{
+		  "app",
+		  "--single-threaded",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		  "--plant-region-graph",
+		};
+		tacos::app::Launcher launcher{argv.size(), argv.data()};
+		CHECK_NOTHROW(launcher.run());
+		const auto &plain_statistics = plain_launcher.get_statistics();
+		const auto &statistics       = launcher.get_statistics();
+		CHECK(plain_statistics.region_graph_configurations == 0);
+		CHECK(statistics.region_graph_configurations > 0);
+		// The successors from the region graph are the same as the ones computed on demand.
+		CHECK(statistics.search_nodes == plain_statistics.search_nodes);
+		CHECK(statistics.root_label == plain_statistics.root_label);
+	}
+	SECTION("Cache the plant's enabled transitions")
+	{
+		const std::array plain_argv{
+		  "app",
+		  "--single-threaded",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		};
+		tacos::app::Launcher plain_launcher{plain_argv.size(), plain_argv.data()};
+		CHECK_NOTHROW(plain_launcher.run());
+		const std::array argv{
+		  "app",
+		  "--single-threaded",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		  "--plant-successor-cache",
+		  "100",
+		};
+		tacos::app::Launcher launcher{argv.size(), argv.data()};
+		CHECK_NOTHROW(launcher.run());
+		const auto &plain_statistics = plain_launcher.get_statistics();
+		const auto &statistics       = launcher.get_statistics();
+		CHECK(plain_statistics.search.successor_cache_hits == 0);
+		CHECK(plain_statistics.search.successor_cache_misses == 0);
+		CHECK(statistics.search.successor_cache_hits > 0);
+		CHECK(statistics.search.successor_cache_misses > 0);
+		// The cached transitions yield the same successors as the ones computed on demand.
+		CHECK(statistics.search_nodes == plain_statistics.search_nodes);
+		CHECK(statistics.root_label == plain_statistics.root_label);
+	}
+	SECTION("Only construct the reachable part of the plant")
+	{
+		// The location l1 of this plant is not reachable from the initial location.
+		const std::filesystem::path unreachable_plant_path =
+		  test_data_dir / "unreachable" / "plant.pbtxt";
+		const std::array full_argv{
+		  "app",
+		  "--plant",
+		  unreachable_plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		};
+		tacos::app::Launcher full_launcher{full_argv.size(), full_argv.data()};
+		CHECK_NOTHROW(full_launcher.run());
+		const std::array argv{
+		  "app",
+		  "--plant",
+		  unreachable_plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		  "--reachable-plant",
+		};
+		tacos::app::Launcher launcher{argv.size(), argv.data()};
+		CHECK_NOTHROW(launcher.run());
+		CHECK(full_launcher.get_statistics().plant_locations == 2);
+		CHECK(launcher.get_statistics().plant_locations == 1);
+		CHECK(launcher.get_statistics().root_label == full_launcher.get_statistics().root_label);
+	}
+	SECTION("Report the search progress")
+	{
+		const std::filesystem::path progress_path = test_scenario_dir / "progress.json";
+		std::filesystem::remove(progress_path);
+		const std::array argv{
+		  "app",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		  "--progress-interval",
+		  "1",
+		  "--progress-file",
+		  progress_path.c_str(),
+		};
+		tacos::app::Launcher launcher{argv.size(), argv.data()};
+		CHECK_NOTHROW(launcher.run());
+		CHECK(std::filesystem::file_size(progress_path) > 0);
+	}
+	SECTION("Stop the search when the budget is exceeded")
+	{
+		const std::array argv{
+		  "app",
+		  "--single-threaded",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		  "--node-budget",
+		  "1",
+		  "--time-budget",
+		  "60",
+		  "--memory-budget",
+		  "1024",
+		};
+		tacos::app::Launcher launcher{argv.size(), argv.data()};
+		CHECK_NOTHROW(launcher.run());
+		const auto &statistics = launcher.get_statistics();
+		CHECK(statistics.budget_exceeded);
+		// Only the root is expanded, afterwards the graph already has more nodes than the budget.
+		CHECK(statistics.search.expanded_nodes == 1);
+		CHECK(statistics.search_nodes > 1);
+		// Without a budget, the search expands more nodes.
+		const std::array unbounded_argv{
+		  "app",
+		  "--single-threaded",
+		  "--plant",
+		  plant_path.c_str(),
+		  "--spec",
+		  spec_path.c_str(),
+		  "-c",
+		  "c",
+		};
+		tacos::app::Launcher unbounded_launcher{unbounded_argv.size(), unbounded_argv.data()};
+		CHECK_NOTHROW(unbounded_launcher.run());
+		CHECK(!unbounded_launcher.get_statistics().budget_exceeded);
+		CHECK(unbounded_launcher.get_statistics().search.expanded_nodes > 1);
+	}
 	SECTION("Visualizations")
 	{
 		const std::array argv{
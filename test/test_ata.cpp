@@ -187,6 +187,42 @@ TEST_CASE("Simple ATA with a disjunction", "[ta]")
 	}
 }
 
+TEST_CASE("ATA symbol steps only result in minimal configurations", "[ta]")
+{
+	std::set<Transition<std::string, std::string>> transitions;
+	transitions.insert(
+	  Transition<std::string, std::string>("s0",
+	                                       "a",
+	                                       std::make_unique<DisjunctionFormula<std::string>>(
+	                                         std::make_unique<LocationFormula<std::string>>("s2"),
+	                                         std::make_unique<LocationFormula<std::string>>("s3"))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s1", "a", std::make_unique<LocationFormula<std::string>>("s2")));
+	transitions.insert(
+	  Transition<std::string, std::string>("s1",
+	                                       "b",
+	                                       std::make_unique<DisjunctionFormula<std::string>>(
+	                                         std::make_unique<LocationFormula<std::string>>("s2"),
+	                                         std::make_unique<LocationFormula<std::string>>("s3"))));
+	transitions.insert(
+	  Transition<std::string, std::string>("s0",
+	                                       "b",
+	                                       std::make_unique<DisjunctionFormula<std::string>>(
+	                                         std::make_unique<LocationFormula<std::string>>("s2"),
+	                                         std::make_unique<LocationFormula<std::string>>("s4"))));
+	AlternatingTimedAutomaton<std::string, std::string> ata({"a", "b"},
+	                                                        "s0",
+	                                                        {"s0"},
+	                                                        std::move(transitions));
+	// {s3, s2} is a superset of {s2} and therefore pruned.
+	CHECK(ata.make_symbol_step(Configuration<std::string>{{"s0", 0}, {"s1", 0}}, "a")
+	      == std::set<Configuration<std::string>>{Configuration<std::string>{{"s2", 0}}});
+	// {s2, s3} and {s4, s2} are supersets of {s2}, {s4, s3} is minimal.
+	CHECK(ata.make_symbol_step(Configuration<std::string>{{"s0", 0}, {"s1", 0}}, "b")
+	      == std::set{Configuration<std::string>{{"s2", 0}},
+	                  Configuration<std::string>{{"s3", 0}, {"s4", 0}}});
+}
+
 TEST_CASE("ATA accepting no events with a time difference of exactly 1"
           " (example by Ouaknine & Worrell, 2005)")
 {
@@ -401,6 +437,7 @@ TEST_CASE("ATA with sink location", "[ta]")
 	  "s0", "a", std::make_unique<LocationFormula<std::string>>("s0")));
 	AlternatingTimedAutomaton<std::string, std::string> ata(
 	  {"a", "b"}, "s0", {"s0"}, std::move(transitions), "sink");
+	CHECK(ata.get_locations() == std::set<std::string>{"s0", "sink"});
 	CHECK(ata.make_symbol_step(Configuration<std::string>{{"s0", 0}}, "a")
 	      == std::set{{Configuration<std::string>{{"s0", 0}}}});
 	CHECK(ata.make_symbol_step(Configuration<std::string>{{"s0", 0}}, "b")
@@ -410,6 +447,75 @@ TEST_CASE("ATA with sink location", "[ta]")
 	CHECK(!ata.accepts_word({{"b", 0}, {"b", 1}, {"a", 2}}));
 }
 
+TEST_CASE("Acceptance distances of ATA locations", "[ta]")
+{
+	std::set<Transition<std::string, std::string>> transitions;
+	// s1 needs both s2 and s3, s3 can only reach the final location s0 through s2.
+	transitions.insert(Transition<std::string, std::string>(
+	  "s1",
+	  "a",
+	  std::make_unique<ConjunctionFormula<std::string>>(
+	    std::make_unique<LocationFormula<std::string>>("s2"),
+	    std::make_unique<LocationFormula<std::string>>("s3"))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s2",
+	  "a",
+	  std::make_unique<DisjunctionFormula<std::string>>(
+	    std::make_unique<LocationFormula<std::string>>("s0"),
+	    std::make_unique<LocationFormula<std::string>>("s4"))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s3", "a", std::make_unique<LocationFormula<std::string>>("s2")));
+	// Clock constraints are ignored.
+	transitions.insert(Transition<std::string, std::string>(
+	  "s3",
+	  "b",
+	  std::make_unique<ClockConstraintFormula<std::string>>(
+	    AtomicClockConstraintT<std::greater<Time>>(1))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s4", "a", std::make_unique<FalseFormula<std::string>>()));
+	AlternatingTimedAutomaton<std::string, std::string> ata(
+	  {"a", "b"}, "s1", {"s0"}, std::move(transitions), "sink");
+	CHECK(ata.get_acceptance_distances()
+	      == std::map<std::string, std::size_t>{{"s0", 0}, {"s1", 2}, {"s2", 1}, {"s3", 1}});
+}
+
+TEST_CASE("Largest constants of ATA locations", "[ta]")
+{
+	std::set<Transition<std::string, std::string>> transitions;
+	// s1 keeps the clock of s0, while s2 starts with a reset clock.
+	transitions.insert(Transition<std::string, std::string>(
+	  "s0",
+	  "a",
+	  std::make_unique<ConjunctionFormula<std::string>>(
+	    std::make_unique<LocationFormula<std::string>>("s1"),
+	    std::make_unique<ResetClockFormula<std::string>>(
+	      std::make_unique<LocationFormula<std::string>>("s2")))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s0",
+	  "b",
+	  std::make_unique<ClockConstraintFormula<std::string>>(
+	    AtomicClockConstraintT<std::less<Time>>(1))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s1",
+	  "a",
+	  std::make_unique<ClockConstraintFormula<std::string>>(
+	    AtomicClockConstraintT<std::greater<Time>>(4))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s2",
+	  "a",
+	  std::make_unique<DisjunctionFormula<std::string>>(
+	    std::make_unique<ClockConstraintFormula<std::string>>(
+	      AtomicClockConstraintT<std::equal_to<Time>>(2)),
+	    std::make_unique<LocationFormula<std::string>>("s3"))));
+	transitions.insert(Transition<std::string, std::string>(
+	  "s3", "a", std::make_unique<TrueFormula<std::string>>()));
+	AlternatingTimedAutomaton<std::string, std::string> ata(
+	  {"a", "b"}, "s0", {"s3"}, std::move(transitions), "sink");
+	// s0 inherits the constant of s1, but not the one of s2, as the clock of s2 is reset.
+	CHECK(ata.get_largest_constants()
+	      == std::map<std::string, Endpoint>{{"s0", 4}, {"s1", 4}, {"s2", 2}, {"s3", 0}});
+}
+
 TEST_CASE("ATA must not contain the sink location in any transition", "[ta]")
 {
 	std::set<Transition<std::string, std::string>> transitions;
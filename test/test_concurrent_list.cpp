@@ -0,0 +1,65 @@
+/***************************************************************************
+ *  test_concurrent_list.cpp - Test the lock-free list
+ *
+ *  Created:   Fri 16 Oct 2026 13:40:17 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#include "utilities/concurrent_list.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace tacos;
+
+using utilities::ConcurrentList;
+
+TEST_CASE("Add elements to a concurrent list", "[concurrent_list]")
+{
+	ConcurrentList<int> list;
+	CHECK(list.empty());
+	CHECK(list.size() == 0);
+	CHECK(list.begin() == list.end());
+	list.push_front(1);
+	list.push_front(2);
+	list.push_front(3);
+	CHECK(!list.empty());
+	CHECK(list.size() == 3);
+	CHECK(list.contains(2));
+	CHECK(!list.contains(4));
+	CHECK(std::vector<int>(list.begin(), list.end()) == std::vector{3, 2, 1});
+	const ConcurrentList<int> initialized_list{1, 2};
+	CHECK(initialized_list.size() == 2);
+	CHECK(initialized_list.contains(1));
+}
+
+TEST_CASE("Add elements to a concurrent list from multiple threads", "[concurrent_list]")
+{
+	ConcurrentList<int>      list;
+	constexpr int            num_threads         = 8;
+	constexpr int            elements_per_thread = 1000;
+	std::vector<std::thread> threads;
+	// Catch2 assertions are not thread-safe, so the workers only count the missing elements.
+	std::atomic_int missing_elements{0};
+	for (int thread = 0; thread < num_threads; ++thread) {
+		threads.emplace_back([&list, &missing_elements, thread] {
+			for (int i = 0; i < elements_per_thread; ++i) {
+				list.push_front(thread * elements_per_thread + i);
+				// Iterate while the other threads are adding elements.
+				if (!list.contains(thread * elements_per_thread + i)) {
+					++missing_elements;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	CHECK(missing_elements == 0);
+	CHECK(list.size() == num_threads * elements_per_thread);
+	CHECK(std::set<int>(list.begin(), list.end()).size() == num_threads * elements_per_thread);
+}
@@ -34,6 +34,9 @@ TEST_CASE("Test BFS heuristic", "[search][heuristics]")
 	long h3 = bfs.compute_cost(nullptr);
 	CHECK(h1 < h2);
 	CHECK(h2 < h3);
+	// The cost only depends on the order of the calls, so it must not be recomputed.
+	CHECK(!bfs.depends_on_region_increments());
+	CHECK(!bfs.is_deterministic());
 }
 TEST_CASE("Test DFS heuristic", "[search][heuristics]")
 {
@@ -44,6 +47,8 @@ TEST_CASE("Test DFS heuristic", "[search][heuristics]")
 	long h3 = dfs.compute_cost(nullptr);
 	CHECK(h1 > h2);
 	CHECK(h2 > h3);
+	CHECK(!dfs.depends_on_region_increments());
+	CHECK(!dfs.is_deterministic());
 }
 
 TEST_CASE("Test time heuristic", "[search][heuristics]")
@@ -71,6 +76,8 @@ TEST_CASE("Test time heuristic", "[search][heuristics]")
 	c2->add_child({2, "a"}, cc2);
 	c2->add_child({4, "a"}, cc2);
 	CHECK(h.compute_cost(cc2.get()) == 5);
+	CHECK(h.depends_on_region_increments());
+	CHECK(h.is_deterministic());
 }
 
 TEST_CASE("Test PreferEnvironmentActionHeuristic", "[search][heuristics]")
@@ -119,6 +126,35 @@ TEST_CASE("Test NumCanonicalWordsHeuristic", "[search][heuristics]")
 	CHECK(h.compute_cost(n3.get()) == 2);
 }
 
+TEST_CASE("Test AcceptanceDistanceHeuristic", "[search][heuristics]")
+{
+	using Location        = automata::ta::Location<std::string>;
+	using DistanceNode    = search::SearchTreeNode<Location, std::string>;
+	using CanonicalABWord = search::CanonicalABWord<Location, std::string>;
+	using TARegionState   = search::PlantRegionState<Location>;
+	using ATARegionState  = search::ATARegionState<std::string>;
+	const logic::MTLFormula a{logic::AtomicProposition<std::string>{"a"}};
+	const logic::MTLFormula b{logic::AtomicProposition<std::string>{"b"}};
+	const logic::MTLFormula c{logic::AtomicProposition<std::string>{"c"}};
+	search::AcceptanceDistanceHeuristic<long, DistanceNode, Location, logic::MTLFormula<std::string>>
+	  h{{{Location{"l0"}, 0}, {Location{"l1"}, 2}}, {{a, 0}, {b, 3}}};
+	DistanceNode n1{std::set{CanonicalABWord{{TARegionState{Location{"l1"}, "x", 0}}}}};
+	CHECK(h.compute_cost(&n1) == 2);
+	// The word is only as close as its most distant component.
+	DistanceNode n2{std::set{
+	  CanonicalABWord{{TARegionState{Location{"l0"}, "x", 0}}, {ATARegionState{b, 1}}}}};
+	CHECK(h.compute_cost(&n2) == 3);
+	// The node is as close as its closest word.
+	DistanceNode n3{
+	  std::set{CanonicalABWord{{TARegionState{Location{"l0"}, "x", 0}}, {ATARegionState{b, 1}}},
+	           CanonicalABWord{{TARegionState{Location{"l0"}, "x", 0}}, {ATARegionState{a, 1}}}}};
+	CHECK(h.compute_cost(&n3) == 0);
+	// Unknown locations cannot reach an accepting configuration and are the most expensive.
+	DistanceNode n4{std::set{
+	  CanonicalABWord{{TARegionState{Location{"l0"}, "x", 0}}, {ATARegionState{c, 1}}}}};
+	CHECK(h.compute_cost(&n4) == 4);
+}
+
 TEST_CASE("Test CompositeHeuristic", "[search][heuristics]")
 {
 	auto root                         = std::make_shared<Node>(std::set<CanonicalABWord>{});
@@ -154,6 +190,27 @@ TEST_CASE("Test CompositeHeuristic", "[search][heuristics]")
 		CHECK(h.compute_cost(n1.get()) == 0);
 		CHECK(h.compute_cost(n2.get()) == w_time * 1 + w_env * 1);
 		CHECK(h.compute_cost(n3.get()) == w_time * 2);
+		CHECK(h.depends_on_region_increments());
+		CHECK(h.is_deterministic());
+	}
+	SECTION("A composite with a node counter is not deterministic")
+	{
+		std::vector<std::pair<
+		  long,
+		  std::unique_ptr<search::Heuristic<long, search::SearchTreeNode<std::string, std::string>>>>>
+		  heuristics;
+		heuristics.emplace_back(
+		  1,
+		  std::make_unique<
+		    search::TimeHeuristic<long, search::SearchTreeNode<std::string, std::string>>>());
+		heuristics.emplace_back(
+		  1,
+		  std::make_unique<
+		    search::BfsHeuristic<long, search::SearchTreeNode<std::string, std::string>>>());
+		search::CompositeHeuristic<long, search::SearchTreeNode<std::string, std::string>> h{
+		  std::move(heuristics)};
+		CHECK(h.depends_on_region_increments());
+		CHECK(!h.is_deterministic());
 	}
 }
 
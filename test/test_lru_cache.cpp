@@ -0,0 +1,88 @@
+/***************************************************************************
+ *  test_lru_cache.cpp - Test the least-recently-used cache
+ *
+ *  Created:   Fri 16 Oct 2026 14:45:32 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#include "utilities/lru_cache.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tacos;
+
+using utilities::LruCache;
+
+TEST_CASE("Look up values in an LRU cache", "[lru_cache]")
+{
+	LruCache<int, std::string> cache{2};
+	CHECK(cache.get_capacity() == 2);
+	CHECK(cache.size() == 0);
+	CHECK(cache.get(1) == nullptr);
+	CHECK(*cache.put(1, "one") == "one");
+	CHECK(*cache.put(2, "two") == "two");
+	CHECK(cache.size() == 2);
+	REQUIRE(cache.get(1) != nullptr);
+	CHECK(*cache.get(1) == "one");
+	CHECK(cache.get_hits() == 2);
+	CHECK(cache.get_misses() == 1);
+	CHECK(cache.get_hit_rate() == 2. / 3.);
+	SECTION("The least recently used entry is evicted")
+	{
+		const auto two = cache.get(2);
+		cache.put(3, "three");
+		CHECK(cache.size() == 2);
+		CHECK(cache.get(1) == nullptr);
+		CHECK(*cache.get(3) == "three");
+		// Evicted values stay valid for the callers that hold them.
+		cache.put(4, "four");
+		CHECK(cache.get(2) == nullptr);
+		CHECK(*two == "two");
+	}
+	SECTION("Putting an existing key replaces the value")
+	{
+		cache.put(2, "zwei");
+		CHECK(cache.size() == 2);
+		CHECK(*cache.get(2) == "zwei");
+		CHECK(*cache.get(1) == "one");
+	}
+}
+
+TEST_CASE("An LRU cache must have a positive capacity", "[lru_cache]")
+{
+	CHECK_THROWS_AS((LruCache<int, int>{0}), std::invalid_argument);
+	CHECK(LruCache<int, int>{1}.get_hit_rate() == 0);
+}
+
+TEST_CASE("Access an LRU cache from multiple threads", "[lru_cache]")
+{
+	LruCache<int, int>       cache{16};
+	std::vector<std::thread> threads;
+	// Catch2 assertions are not thread-safe, so the workers only count the wrong values.
+	std::atomic_int mismatches{0};
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&cache, &mismatches]() {
+			for (int i = 0; i < 1000; ++i) {
+				if (const auto value = cache.get(i % 32); value != nullptr) {
+					if (*value != 2 * (i % 32)) {
+						++mismatches;
+					}
+				} else {
+					cache.put(i % 32, 2 * (i % 32));
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	CHECK(mismatches == 0);
+	CHECK(cache.size() == 16);
+	CHECK(cache.get_hits() + cache.get_misses() == 4000);
+}
@@ -7,15 +7,18 @@
  ****************************************************************************/
 
 
+#include "utilities/cpu_topology.h"
 #include "utilities/priority_thread_pool.h"
 #include "utilities/priority_thread_pool.hpp"
 
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <set>
 #include <thread>
+#include <vector>
 
 using namespace tacos;
 
@@ -146,5 +149,55 @@ TEST_CASE("Direct access to a thread pool", "[threading]")
 		CHECK_THROWS_AS(queue_access.empty(), utilities::QueueStartedException);
 		CHECK_THROWS_AS(queue_access.top(), utilities::QueueStartedException);
 		CHECK_THROWS_AS(queue_access.pop(), utilities::QueueStartedException);
+		pool.finish();
+		CHECK(pool.get_queue_size() == 0);
+	}
+	SECTION("Get the queue size without direct access")
+	{
+		CHECK(pool.get_queue_size() == 10);
+	}
+	SECTION("Discard all queued jobs")
+	{
+		CHECK(pool.clear_queue() == 10);
+		CHECK(queue_access.empty());
+		pool.start();
+		pool.finish();
+		CHECK(res.empty());
 	}
 }
+
+TEST_CASE("Pin the workers of a thread pool to NUMA nodes", "[threading]")
+{
+	CHECK(utilities::parse_cpu_list("0-3,8,10-11\n")
+	      == std::vector<unsigned int>{0, 1, 2, 3, 8, 10, 11});
+	CHECK(utilities::parse_cpu_list("").empty());
+	CHECK_THROWS(utilities::parse_cpu_list("3-1"));
+	const auto numa_nodes = utilities::get_numa_nodes();
+	REQUIRE(!numa_nodes.empty());
+	CHECK(std::none_of(std::begin(numa_nodes), std::end(numa_nodes), [](const auto &cpus) {
+		return cpus.empty();
+	}));
+
+	ThreadPool<int> unpinned_pool{ThreadPool<int>::StartOnInit::NO, 2};
+	CHECK(unpinned_pool.get_num_domains() == 1);
+	ThreadPool<int> pool{ThreadPool<int>::StartOnInit::NO, 4, ThreadPool<int>::Affinity::NUMA};
+	CHECK(pool.get_num_domains() == numa_nodes.size());
+	// The calling thread is not a worker.
+	CHECK(pool.get_current_domain() == 0);
+	std::set<std::size_t> domains;
+	std::set<std::size_t> other_pool_domains;
+	std::mutex            domains_mutex;
+	for (int i = 0; i < 16; ++i) {
+		pool.add_job([&] {
+			std::lock_guard guard{domains_mutex};
+			domains.insert(pool.get_current_domain());
+			// The domain of a worker only refers to its own pool.
+			other_pool_domains.insert(unpinned_pool.get_current_domain());
+		});
+	}
+	pool.start();
+	pool.finish();
+	REQUIRE(!domains.empty());
+	CHECK(*domains.rbegin() < pool.get_num_domains());
+	CHECK(other_pool_domains == std::set<std::size_t>{0});
+}
@@ -7,9 +7,11 @@
  ****************************************************************************/
 
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#include "automata/ta_region_graph.h"
 #include "mtl/MTLFormula.h"
 #include "mtl_ata_translation/translator.h"
 #include "search/create_controller.h"
+#include "search/portfolio.h"
 #include "search/search.h"
 #include "search/search_tree.h"
 #include "search/synchronous_product.h"
@@ -69,6 +71,7 @@ using AP              = logic::AtomicProposition<std::string>;
 using automata::AtomicClockConstraintT;
 using search::NodeLabel;
 using search::NodeState;
+using search::SearchProgress;
 using AP = logic::AtomicProposition<std::string>;
 using ::utilities::arithmetic::BoundType;
 using Location = automata::ta::Location<std::string>;
@@ -384,6 +387,63 @@ TEST_CASE("An illustrative example", "[search]")
 	search.label();
 	CHECK(search.get_root()->label == NodeLabel::TOP);
 
+	const auto statistics = search.get_statistics();
+	CHECK(statistics.expanded_nodes > 0);
+	CHECK(statistics.expanded_nodes <= search.get_size());
+	CHECK(statistics.bad_nodes + statistics.good_nodes + statistics.dead_nodes
+	        + statistics.domination_prunes
+	      <= statistics.expanded_nodes);
+	CHECK(statistics.cancellations == 0);
+	// The nodes of all partitions are collected.
+	CHECK(search.get_nodes().size() == search.get_size());
+	// Expanding a node again, e.g., because it was queued twice, does not change anything.
+	const auto num_children = search.get_root()->get_children().size();
+	search.expand_node(search.get_root());
+	CHECK(search.get_root()->get_children().size() == num_children);
+	CHECK(search.get_statistics().expanded_nodes == statistics.expanded_nodes);
+
+	SECTION("Each node is queued at most once")
+	{
+		TreeSearch new_search(&ta, &ata, {"a"}, {"e"}, 1, true);
+		CHECK(new_search.get_progress().queue_size == 1);
+		new_search.add_node_to_queue(new_search.get_root());
+		CHECK(new_search.get_progress().queue_size == 1);
+	}
+	SECTION("Stop the search as soon as the root is labeled")
+	{
+		TreeSearch search_terminate_early(&ta, &ata, {"a"}, {"e"}, 1, true, true);
+		search_terminate_early.build_tree(false);
+		CHECK(search_terminate_early.get_root()->label == NodeLabel::TOP);
+		CHECK(search_terminate_early.get_progress().queue_size == 0);
+		CHECK(search_terminate_early.get_statistics().expanded_nodes <= statistics.expanded_nodes);
+		search_terminate_early.label();
+		CHECK(search_terminate_early.get_root()->label == NodeLabel::TOP);
+	}
+	SECTION("Report the search progress")
+	{
+		std::vector<SearchProgress> reports;
+		TreeSearch                  search_with_progress(&ta, &ata, {"a"}, {"e"}, 1, true);
+		search_with_progress.set_progress_reporter(
+		  [&reports](const SearchProgress &progress) { reports.push_back(progress); });
+		search_with_progress.build_tree(false);
+		REQUIRE(!reports.empty());
+		const auto &final_report = reports.back();
+		CHECK(final_report.queue_size == 0);
+		CHECK(final_report.nodes == search_with_progress.get_size());
+		CHECK(final_report.expanded_nodes > 0);
+		CHECK(final_report.labeled_nodes <= final_report.nodes);
+		CHECK(final_report.memory_estimate > 0);
+		CHECK(final_report.root_label == NodeLabel::TOP);
+		CHECK(search::to_json(final_report).find(R"("root_label": "TOP")") != std::string::npos);
+		// The labeled nodes are counted while labeling, not by iterating over the nodes.
+		const auto nodes = search_with_progress.get_nodes();
+		CHECK(search_with_progress.get_progress().labeled_nodes
+		      == static_cast<std::size_t>(
+		        std::count_if(std::begin(nodes), std::end(nodes), [](const auto &node) {
+			        return node->label == NodeLabel::TOP || node->label == NodeLabel::BOTTOM;
+		        })));
+	}
+
 	visualization::search_tree_to_graphviz(*search.get_root()).render_to_file("example_search.dot");
 	visualization::ta_to_graphviz(ta).render_to_file("example_ta.dot");
 	visualization::ta_to_graphviz(
@@ -391,6 +451,328 @@ TEST_CASE("An illustrative example", "[search]")
 	  .render_to_file("example_controller.dot");
 }
 
+TEST_CASE("Insert and look up search nodes from multiple threads", "[search]")
+{
+	TA ta{{"a", "b"}, Location{"l0"}, {Location{"l0"}, Location{"l1"}}};
+	ta.add_clock("x");
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "a",
+	                               Location{"l0"},
+	                               {{"x", AtomicClockConstraintT<std::greater<Time>>(1)}},
+	                               {"x"}));
+	ta.add_transition(TATransition(
+	  Location{"l0"}, "b", Location{"l1"}, {{"x", AtomicClockConstraintT<std::less<Time>>(1)}}));
+	logic::MTLFormula<std::string> a{AP("a")};
+	logic::MTLFormula<std::string> b{AP("b")};
+
+	logic::MTLFormula spec = a.until(b, logic::TimeInterval{2, BoundType::WEAK, 2, BoundType::INFTY});
+	auto              ata  = mtl_ata_translation::translate(spec, {AP{"a"}, AP{"b"}});
+	TreeSearch        single_threaded_search(&ta, &ata, {"a"}, {"b"}, 2);
+	single_threaded_search.build_tree(false);
+	TreeSearch multi_threaded_search(&ta,
+	                                 &ata,
+	                                 {"a"},
+	                                 {"b"},
+	                                 2,
+	                                 false,
+	                                 false,
+	                                 std::make_unique<search::BfsHeuristic<long, Node>>(),
+	                                 8);
+	multi_threaded_search.build_tree(true);
+	// The workers insert nodes into the partitions concurrently. Each node must still be found by
+	// the other workers, so every set of words belongs to exactly one node.
+	const auto nodes = multi_threaded_search.get_nodes();
+	CHECK(nodes.size() == multi_threaded_search.get_size());
+	CHECK(multi_threaded_search.get_size() == single_threaded_search.get_size());
+	std::set<std::set<CanonicalABWord>> words;
+	for (const auto &node : nodes) {
+		words.insert(node->words);
+	}
+	CHECK(words.size() == nodes.size());
+}
+
+TEST_CASE("Search with a precomputed plant region graph", "[search]")
+{
+	TA ta{{"e", "a"}, Location{"l0"}, {Location{"l0"}, Location{"l1"}}};
+	ta.add_clock("c");
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "e",
+	                               Location{"l1"},
+	                               {{"c", AtomicClockConstraintT<std::equal_to<Time>>(1)}},
+	                               {"c"}));
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "a",
+	                               Location{"l0"},
+	                               {{"c", AtomicClockConstraintT<std::greater<Time>>(0)}},
+	                               {"c"}));
+	logic::MTLFormula<std::string> e{AP("e")};
+
+	logic::MTLFormula spec =
+	  e || finally(e, logic::TimeInterval{0, BoundType::WEAK, 1, BoundType::STRICT});
+	auto       ata = mtl_ata_translation::translate(spec, {AP{"a"}, AP{"e"}});
+	TreeSearch search(&ta, &ata, {"a"}, {"e"}, 1, true);
+	search.build_tree(false);
+	search.label();
+	const automata::ta::RegionGraph<std::string, std::string> region_graph{ta, 1};
+	TreeSearch search_with_graph(&ta, &ata, {"a"}, {"e"}, 1, true);
+	search_with_graph.get_successor_generator().set_region_graph(&region_graph);
+	search_with_graph.build_tree(false);
+	search_with_graph.label();
+	CHECK(search_with_graph.get_root()->label == search.get_root()->label);
+	CHECK(search_with_graph.get_nodes().size() == search.get_nodes().size());
+}
+
+TEST_CASE("Search with a maximal constant for each clock", "[search]")
+{
+	TA ta{{"e", "a", "b"}, Location{"l0"}, {Location{"l0"}, Location{"l1"}}};
+	ta.add_clock("c");
+	ta.add_clock("d");
+	ta.add_clock("f");
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "e",
+	                               Location{"l1"},
+	                               {{"c", AtomicClockConstraintT<std::equal_to<Time>>(1)}},
+	                               {"c"}));
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "a",
+	                               Location{"l0"},
+	                               {{"d", AtomicClockConstraintT<std::greater<Time>>(1)}},
+	                               {"d"}));
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "b",
+	                               Location{"l1"},
+	                               {{"f", AtomicClockConstraintT<std::greater<Time>>(3)}}));
+	logic::MTLFormula<std::string> e{AP("e")};
+
+	logic::MTLFormula spec =
+	  e || finally(e, logic::TimeInterval{0, BoundType::WEAK, 1, BoundType::STRICT});
+	auto ata = mtl_ata_translation::translate(spec, {AP{"a"}, AP{"b"}, AP{"e"}});
+	const RegionIndex K = std::max(ta.get_largest_constant(), spec.get_largest_constant());
+	CHECK(K == 3);
+	TreeSearch search(&ta, &ata, {"a", "b"}, {"e"}, K);
+	search.build_tree(false);
+	search.label();
+	// Only f needs to be distinguished up to 3, all other clocks only up to 1.
+	const search::MaxConstants<std::string> max_constants{K,
+	                                                      ta.get_largest_constants(),
+	                                                      ata.get_largest_constants()};
+	CHECK(max_constants.get_clock_constant("c") == 1);
+	CHECK(max_constants.get_clock_constant("d") == 1);
+	CHECK(max_constants.get_clock_constant("f") == 3);
+	TreeSearch search_with_constants(&ta, &ata, {"a", "b"}, {"e"}, max_constants);
+	search_with_constants.build_tree(false);
+	search_with_constants.label();
+	CHECK(search_with_constants.get_root()->label == search.get_root()->label);
+	CHECK(search_with_constants.get_nodes().size() < search.get_nodes().size());
+}
+
+TEST_CASE("Search with a cache of the plant's enabled transitions", "[search]")
+{
+	TA ta{{"e", "a"}, Location{"l0"}, {Location{"l0"}, Location{"l1"}}};
+	ta.add_clock("c");
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "e",
+	                               Location{"l1"},
+	                               {{"c", AtomicClockConstraintT<std::equal_to<Time>>(1)}},
+	                               {"c"}));
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "a",
+	                               Location{"l0"},
+	                               {{"c", AtomicClockConstraintT<std::greater<Time>>(0)}},
+	                               {"c"}));
+	logic::MTLFormula<std::string> e{AP("e")};
+
+	logic::MTLFormula spec =
+	  e || finally(e, logic::TimeInterval{0, BoundType::WEAK, 1, BoundType::STRICT});
+	auto       ata = mtl_ata_translation::translate(spec, {AP{"a"}, AP{"e"}});
+	TreeSearch search(&ta, &ata, {"a"}, {"e"}, 1, true);
+	search.build_tree(false);
+	search.label();
+	TreeSearch search_with_cache(&ta, &ata, {"a"}, {"e"}, 1, true);
+	search_with_cache.get_successor_generator().enable_successor_cache(4);
+	search_with_cache.build_tree(false);
+	search_with_cache.label();
+	CHECK(search_with_cache.get_root()->label == search.get_root()->label);
+	CHECK(search_with_cache.get_nodes().size() == search.get_nodes().size());
+	const auto &statistics = search_with_cache.get_statistics();
+	CHECK(statistics.successor_cache_hits > 0);
+	CHECK(statistics.successor_cache_hits + statistics.successor_cache_misses
+	      == search_with_cache.get_successor_generator().get_successor_cache()->get_hits()
+	           + search_with_cache.get_successor_generator().get_successor_cache()->get_misses());
+}
+
+TEST_CASE("Search with a limited budget", "[search]")
+{
+	TA ta{{"e", "a"}, Location{"l0"}, {Location{"l0"}, Location{"l1"}}};
+	ta.add_clock("c");
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "e",
+	                               Location{"l1"},
+	                               {{"c", AtomicClockConstraintT<std::equal_to<Time>>(1)}},
+	                               {"c"}));
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "a",
+	                               Location{"l0"},
+	                               {{"c", AtomicClockConstraintT<std::greater<Time>>(0)}},
+	                               {"c"}));
+	logic::MTLFormula<std::string> e{AP("e")};
+
+	logic::MTLFormula spec =
+	  e || finally(e, logic::TimeInterval{0, BoundType::WEAK, 1, BoundType::STRICT});
+	auto       ata = mtl_ata_translation::translate(spec, {AP{"a"}, AP{"e"}});
+	TreeSearch search(&ta, &ata, {"a"}, {"e"}, 1, true);
+	SECTION("The search stops when the node budget is exceeded")
+	{
+		search.set_budget(search::SearchBudget{{}, 1, {}});
+		search.build_tree(false);
+		search.label();
+		CHECK(search.is_budget_exceeded());
+		CHECK(search.get_statistics().expanded_nodes == 1);
+		CHECK(search.get_size() > 1);
+		// The children of the root have not been expanded, so we cannot find a controller.
+		CHECK(search.get_root()->label == NodeLabel::BOTTOM);
+		for (const auto &[action, child] : search.get_root()->get_children()) {
+			if (child->state == NodeState::UNKNOWN) {
+				CHECK(child->label_reason == search::LabelReason::UNEXPANDED);
+			}
+		}
+	}
+	SECTION("A sufficient budget does not change the result")
+	{
+		search.set_budget(search::SearchBudget{std::chrono::minutes{10}, 1000, 1024 * 1024 * 1024});
+		search.build_tree(false);
+		search.label();
+		CHECK(!search.is_budget_exceeded());
+		CHECK(search.get_root()->label == NodeLabel::TOP);
+	}
+}
+
+TEST_CASE("Portfolio search", "[search]")
+{
+	TA ta{{"e", "a"}, Location{"l0"}, {Location{"l0"}, Location{"l1"}}};
+	ta.add_clock("c");
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "e",
+	                               Location{"l1"},
+	                               {{"c", AtomicClockConstraintT<std::equal_to<Time>>(1)}},
+	                               {"c"}));
+	ta.add_transition(TATransition(Location{"l0"},
+	                               "a",
+	                               Location{"l0"},
+	                               {{"c", AtomicClockConstraintT<std::greater<Time>>(0)}},
+	                               {"c"}));
+	logic::MTLFormula<std::string> e{AP("e")};
+
+	logic::MTLFormula spec =
+	  e || finally(e, logic::TimeInterval{0, BoundType::WEAK, 1, BoundType::STRICT});
+	auto       ata = mtl_ata_translation::translate(spec, {AP{"a"}, AP{"e"}});
+	TreeSearch bfs_search(&ta,
+	                      &ata,
+	                      {"a"},
+	                      {"e"},
+	                      1,
+	                      true,
+	                      true,
+	                      std::make_unique<search::BfsHeuristic<long, Node>>(),
+	                      1);
+	TreeSearch dfs_search(&ta,
+	                      &ata,
+	                      {"a"},
+	                      {"e"},
+	                      1,
+	                      true,
+	                      true,
+	                      std::make_unique<search::DfsHeuristic<long, Node>>(),
+	                      1);
+	SECTION("The first search to finish determines the result")
+	{
+		const auto winner = search::run_portfolio(std::vector{&bfs_search, &dfs_search});
+		REQUIRE(winner.has_value());
+		auto &winning_search = *winner == 0 ? bfs_search : dfs_search;
+		winning_search.label();
+		CHECK(winning_search.get_root()->label == NodeLabel::TOP);
+	}
+	SECTION("Each search of a single-threaded portfolio expands its nodes in its own thread")
+	{
+		const auto winner = search::run_portfolio(std::vector{&bfs_search, &dfs_search}, false);
+		REQUIRE(winner.has_value());
+		auto &winning_search = *winner == 0 ? bfs_search : dfs_search;
+		winning_search.label();
+		CHECK(winning_search.get_root()->label == NodeLabel::TOP);
+	}
+	SECTION("Pin the workers to NUMA nodes")
+	{
+		TreeSearch numa_search(&ta,
+		                       &ata,
+		                       {"a"},
+		                       {"e"},
+		                       1,
+		                       true,
+		                       true,
+		                       std::make_unique<search::BfsHeuristic<long, Node>>(),
+		                       4,
+		                       utilities::ThreadPool<long>::Affinity::NUMA);
+		numa_search.build_tree(true);
+		numa_search.label();
+		CHECK(numa_search.get_root()->label == NodeLabel::TOP);
+		CHECK(numa_search.get_progress().queue_size == 0);
+	}
+	SECTION("A search that exceeds its budget does not win")
+	{
+		bfs_search.set_budget(search::SearchBudget{{}, 1, {}});
+		const auto winner = search::run_portfolio(std::vector{&bfs_search, &dfs_search});
+		CHECK(bfs_search.is_budget_exceeded());
+		CHECK(winner == 1);
+		CHECK(dfs_search.get_root()->label == NodeLabel::TOP);
+	}
+	SECTION("No search wins if all budgets are exceeded")
+	{
+		bfs_search.set_budget(search::SearchBudget{{}, 1, {}});
+		dfs_search.set_budget(search::SearchBudget{{}, 1, {}});
+		CHECK(!search::run_portfolio(std::vector{&bfs_search, &dfs_search}));
+	}
+}
+
+TEST_CASE("Prune nodes that cannot reach a bad configuration", "[search]")
+{
+	TA ta{{"c", "e", "e_bad"}, Location{"l0"}, {Location{"l0"}, Location{"l2"}}};
+	ta.add_location(Location{"l1"});
+	ta.add_clock("x");
+	ta.add_transition(TATransition(Location{"l0"}, "c", Location{"l1"}));
+	ta.add_transition(TATransition(Location{"l1"}, "c", Location{"l1"}));
+	ta.add_transition(TATransition(
+	  Location{"l0"}, "e_bad", Location{"l2"}, {{"x", AtomicClockConstraintT<std::greater<Time>>(1)}}));
+	ta.add_transition(TATransition(Location{"l2"}, "e", Location{"l2"}));
+	logic::MTLFormula spec =
+	  logic::MTLFormula{logic::MTLFormula<std::string>::TRUE().until(AP{"e_bad"})};
+	auto       ata = mtl_ata_translation::translate(spec, {AP{"c"}, AP{"e"}, AP{"e_bad"}});
+	TreeSearch search(&ta, &ata, {"c"}, {"e", "e_bad"}, 1, true);
+	TreeSearch pruning_search(&ta, &ata, {"c"}, {"e", "e_bad"}, 1, true);
+	pruning_search.enable_backward_pruning();
+	search.build_tree(false);
+	search.label();
+	pruning_search.build_tree(false);
+	pruning_search.label();
+	CHECK(search.get_root()->label == NodeLabel::TOP);
+	CHECK(pruning_search.get_root()->label == NodeLabel::TOP);
+	CHECK(search.get_statistics().backward_prunes == 0);
+	CHECK(pruning_search.get_statistics().backward_prunes > 0);
+	CHECK(pruning_search.get_statistics().expanded_nodes <= search.get_statistics().expanded_nodes);
+	// The location l1 cannot reach a final location, so the node is not expanded.
+	const auto &l1_node = pruning_search.get_root()->get_children().at({0, "c"});
+	CHECK(l1_node->state == NodeState::GOOD);
+	CHECK(l1_node->get_children().empty());
+	// Precomputed distances give the same result.
+	TreeSearch precomputed_search(&ta, &ata, {"c"}, {"e", "e_bad"}, 1, true);
+	precomputed_search.enable_backward_pruning(ta.get_acceptance_distances(),
+	                                           ata.get_acceptance_distances());
+	precomputed_search.build_tree(false);
+	precomputed_search.label();
+	CHECK(precomputed_search.get_root()->label == NodeLabel::TOP);
+	CHECK(precomputed_search.get_statistics().backward_prunes
+	      == pruning_search.get_statistics().backward_prunes);
+}
+
 TEST_CASE("Search in an ABConfiguration tree without solution", "[search]")
 {
 	spdlog::set_level(spdlog::level::trace);
@@ -601,6 +983,103 @@ TEST_CASE("Single-step incremental labeling on constructed cases", "[search]")
 	}
 }
 
+TEST_CASE("Atomic labeling and cancellation of search nodes", "[search]")
+{
+	auto root        = create_test_node(dummyWords(0));
+	auto child       = create_test_node(dummyWords(1));
+	auto grandchild  = create_test_node(dummyWords(2));
+	auto other       = create_test_node(dummyWords(3));
+	auto shared_node = create_test_node(dummyWords(4));
+	root->add_child({0, "a"}, child);
+	root->add_child({1, "a"}, child);
+	child->add_child({0, "a"}, grandchild);
+	child->add_child({1, "a"}, shared_node);
+	other->add_child({0, "a"}, shared_node);
+	// The same parent is only stored once, even if the child is reachable with multiple actions.
+	CHECK(child->parents.size() == 1);
+	CHECK(shared_node->parents.size() == 2);
+	SECTION("A node is labeled only once")
+	{
+		CHECK(root->set_label(NodeLabel::TOP));
+		CHECK(!root->set_label(NodeLabel::TOP));
+		CHECK(!root->set_label(NodeLabel::CANCELED));
+		CHECK(root->label == NodeLabel::TOP);
+		CHECK_THROWS(root->set_label(NodeLabel::BOTTOM));
+	}
+	SECTION("Descendants are canceled if all their parents are labeled")
+	{
+		CHECK(root->set_label(NodeLabel::TOP, true));
+		CHECK(child->label == NodeLabel::CANCELED);
+		CHECK(grandchild->label == NodeLabel::CANCELED);
+		// The other parent is still unlabeled, so this node is still needed.
+		CHECK(shared_node->label == NodeLabel::UNLABELED);
+	}
+	SECTION("Labeled descendants are not canceled")
+	{
+		CHECK(child->set_label(NodeLabel::BOTTOM));
+		CHECK(root->set_label(NodeLabel::BOTTOM, true));
+		CHECK(child->label == NodeLabel::BOTTOM);
+		CHECK(grandchild->label == NodeLabel::UNLABELED);
+	}
+	SECTION("A node is not canceled if a parent is added after its parents have been checked")
+	{
+		CHECK(child->label.get_num_parents() == 1);
+		CHECK(shared_node->label.get_num_parents() == 2);
+		const auto num_parents = grandchild->label.get_num_parents();
+		shared_node->add_child({0, "a"}, grandchild);
+		CHECK(!grandchild->label.cancel(num_parents));
+		CHECK(grandchild->label == NodeLabel::UNLABELED);
+		CHECK(grandchild->label.cancel(num_parents + 1));
+		CHECK(grandchild->label == NodeLabel::CANCELED);
+		// The new parent finds the canceled node when it is counted, and changing the label keeps the
+		// number of parents.
+		CHECK(grandchild->label.add_parent() == NodeLabel::CANCELED);
+		grandchild->reset_label();
+		CHECK(grandchild->label == NodeLabel::UNLABELED);
+		CHECK(grandchild->label.get_num_parents() == num_parents + 2);
+	}
+}
+
+TEST_CASE("Propagate the minimal total region increments", "[search]")
+{
+	auto root       = create_test_node(dummyWords(0));
+	auto slow_node  = create_test_node(dummyWords(1));
+	auto fast_node  = create_test_node(dummyWords(2));
+	auto child      = create_test_node(dummyWords(3));
+	auto grandchild = create_test_node(dummyWords(4));
+	root->min_total_region_increments = 0;
+	root->add_child({5, "a"}, slow_node);
+	CHECK(slow_node->add_child({1, "a"}, child) == std::vector<Node *>{child.get()});
+	child->add_child({2, "a"}, grandchild);
+	child->add_child({0, "b"}, child);
+	CHECK(child->min_total_region_increments == 6);
+	CHECK(grandchild->min_total_region_increments == 8);
+	root->add_child({1, "b"}, fast_node);
+	SECTION("The descendants of an expanded node are updated")
+	{
+		// The child can now be reached faster, this must also update the grandchild.
+		const auto improved_nodes = fast_node->add_child({1, "a"}, child);
+		CHECK(std::set<Node *>(std::begin(improved_nodes), std::end(improved_nodes))
+		      == std::set<Node *>{child.get(), grandchild.get()});
+		CHECK(child->min_total_region_increments == 2);
+		CHECK(grandchild->min_total_region_increments == 4);
+		// A slower path does not change anything.
+		CHECK(slow_node->add_child({2, "a"}, grandchild).empty());
+		CHECK(grandchild->min_total_region_increments == 4);
+	}
+	SECTION("The children of a node that is being expanded are updated after the expansion")
+	{
+		child->is_expanded = false;
+		CHECK(fast_node->add_child({1, "a"}, child) == std::vector<Node *>{child.get()});
+		CHECK(child->min_total_region_increments == 2);
+		CHECK(grandchild->min_total_region_increments == 8);
+		child->is_expanded = true;
+		CHECK(child->update_children_min_total_region_increments()
+		      == std::vector<Node *>{grandchild.get()});
+		CHECK(grandchild->min_total_region_increments == 4);
+	}
+}
+
 TEST_CASE("Multi-step incremental labeling on constructed cases", "[search]")
 {
 	spdlog::set_level(spdlog::level::trace);
@@ -760,6 +1239,14 @@ TEST_CASE("Check a node for unsatisfiable ATA configurations", "[search]")
 	CHECK(search::has_satisfiable_ata_configuration(
 	  Node{{CanonicalABWord({{TARegionState{Location{"l0"}, "x", 0}, ATARegionState{a, 0}}}),
 	        CanonicalABWord({{TARegionState{Location{"l0"}, "x", 0}, ATARegionState{a, 0}}})}}));
+	CHECK(search::has_satisfiable_ata_configuration(
+	  Node{{CanonicalABWord({{TARegionState{Location{"l0"}, "x", 0}, ATARegionState{a, 0}}}),
+	        CanonicalABWord({{TARegionState{Location{"l0"}, "x", 0}, ATARegionState{sink, 0}}})}}));
+	CHECK(!search::has_satisfiable_ata_configuration(Node{{}}));
+	CHECK(search::contains_sink(
+	  CanonicalABWord({{TARegionState{Location{"l0"}, "x", 0}}, {ATARegionState{sink, 1}}})));
+	CHECK(!search::contains_sink(
+	  CanonicalABWord({{TARegionState{Location{"l0"}, "x", 0}}, {ATARegionState{a, 1}}})));
 }
 
 TEST_CASE("Search graph with self loops", "[search]")
@@ -13,6 +13,7 @@
 #include "mtl/MTLFormula.h"
 #include "mtl_ata_translation/translator.h"
 #include "search/canonical_word.h"
+#include "search/flat_word.h"
 #include "search/operators.h"
 #include "search/reg_a.h"
 #include "search/search_tree.h"
@@ -282,6 +283,60 @@ TEST_CASE("Get the time successor for a canonical AB word", "[canonical_word]")
 	      == CanonicalABWord{{TARegionState{Location{"s0"}, "c0", 2}}, {ATARegionState{a, 1}}});
 }
 
+TEST_CASE("Canonical words with a maximal constant for each clock", "[canonical_word]")
+{
+	const logic::AtomicProposition<std::string> a{"a"};
+	const logic::AtomicProposition<std::string> b{"b"};
+	const search::MaxConstants<std::string>     K{0, {{"x", 1}, {"y", 2}}, {{a, 2}}};
+	CHECK(K.get_clock_constant("x") == 1);
+	CHECK(K.get_clock_constant("z") == 0);
+	CHECK(K.get_location_constant(a) == 2);
+	CHECK(K.get_location_constant(b) == 0);
+	CHECK(K.get_largest_constant() == 2);
+	CHECK(K.get_max_region_index() == 5);
+
+	SECTION("Each clock is regionalized with its own constant")
+	{
+		const automata::ta::TAConfiguration<std::string> ta_configuration{Location{"s0"},
+		                                                                  {{"x", 2.5}, {"y", 2.5}}};
+		CHECK(get_canonical_word(ta_configuration, ATAConfiguration<std::string>{{a, 2.5}, {b, 0.5}}, K)
+		      == CanonicalABWord({{TARegionState{Location{"s0"}, "x", 3},
+		                           TARegionState{Location{"s0"}, "y", 5},
+		                           ATARegionState{a, 5},
+		                           ATARegionState{b, 1}}}));
+	}
+
+	SECTION("Time successors stop at the maximal region index of each clock")
+	{
+		const auto successors = get_time_successors(
+		  CanonicalABWord(
+		    {{TARegionState{Location{"s0"}, "x", 0}, TARegionState{Location{"s0"}, "y", 0}}}),
+		  K);
+		using TimeSuccessor = std::pair<RegionIndex, CanonicalABWord>;
+		CHECK(successors
+		      == std::vector<TimeSuccessor>{
+		        {0,
+		         CanonicalABWord{
+		           {TARegionState{Location{"s0"}, "x", 0}, TARegionState{Location{"s0"}, "y", 0}}}},
+		        {1,
+		         CanonicalABWord{
+		           {TARegionState{Location{"s0"}, "x", 1}, TARegionState{Location{"s0"}, "y", 1}}}},
+		        {2,
+		         CanonicalABWord{
+		           {TARegionState{Location{"s0"}, "x", 2}, TARegionState{Location{"s0"}, "y", 2}}}},
+		        // x is maxed and moves to the last partition, y is still incremented.
+		        {3,
+		         CanonicalABWord{{TARegionState{Location{"s0"}, "y", 3}},
+		                         {TARegionState{Location{"s0"}, "x", 3}}}},
+		        {4,
+		         CanonicalABWord{{TARegionState{Location{"s0"}, "y", 4}},
+		                         {TARegionState{Location{"s0"}, "x", 3}}}},
+		        {5,
+		         CanonicalABWord{
+		           {TARegionState{Location{"s0"}, "x", 3}, TARegionState{Location{"s0"}, "y", 5}}}}});
+	}
+}
+
 TEST_CASE("Compute the time successors of a set of nodes", "[canonical_word]")
 {
 	const logic::AtomicProposition<std::string> a{"a"};
@@ -680,6 +735,40 @@ TEST_CASE("Get the next canonical word(s)", "[canonical_word]")
 	}
 }
 
+TEST_CASE("Check canonical words for acceptance", "[canonical_word]")
+{
+	using TA = automata::ta::TimedAutomaton<std::string, std::string>;
+	TA ta{
+	  {Location{"s0"}, Location{"s1"}}, {"a", "b"}, Location{"s0"}, {Location{"s1"}}, {"x", "y"}, {}};
+	logic::MTLFormula<std::string> a{AP("a")};
+	logic::MTLFormula<std::string> b{AP("b")};
+	// The dual until is an accepting location of the ATA.
+	const auto f    = a.dual_until(b);
+	const auto ata  = mtl_ata_translation::translate(f);
+	const auto sink = mtl_ata_translation::get_sink<std::string>();
+	const auto s0x0 = TARegionState{Location{"s0"}, "x", 0};
+	const auto s0y1 = TARegionState{Location{"s0"}, "y", 1};
+	const auto s1x0 = TARegionState{Location{"s1"}, "x", 0};
+	const auto s1y0 = TARegionState{Location{"s1"}, "y", 0};
+	const auto s1y1 = TARegionState{Location{"s1"}, "y", 1};
+	const std::vector<std::pair<CanonicalABWord, bool>> words{
+	  {CanonicalABWord({{s0x0}, {s0y1}}), false},
+	  {CanonicalABWord({{s1x0}, {s1y1}}), true},
+	  {CanonicalABWord({{s1x0, s1y0}, {ATARegionState{f, 1}}}), true},
+	  {CanonicalABWord({{s1x0, s1y0}, {ATARegionState{sink, 1}}}), false},
+	  {CanonicalABWord({{s1x0, ATARegionState{f, 2}}, {s1y1, ATARegionState{sink, 3}}}), false},
+	  {CanonicalABWord({{s0x0, ATARegionState{f, 2}}, {s0y1}}), false},
+	};
+	for (const auto &[word, accepting] : words) {
+		CHECK(search::is_accepting_word(ta, ata, word) == accepting);
+		// The result must be the same as for the candidate of the word.
+		const auto candidate = search::get_candidate(word);
+		CHECK(search::is_accepting_word(ta, ata, word)
+		      == (ta.is_accepting_configuration(candidate.first)
+		          && ata.is_accepting_configuration(candidate.second)));
+	}
+}
+
 TEST_CASE("reg_a", "[canonical_word]")
 {
 	CHECK(search::reg_a(CanonicalABWord({{TARegionState{Location{"s0"}, "c0", 0}}}))
@@ -776,6 +865,58 @@ TEST_CASE("monotone_domination_order_sets", "[canonical_word]")
 	                                             {ATARegionState{logic::MTLFormula{AP{"a"}}, 1}}})}));
 }
 
+TEST_CASE("Monotonic domination on flat words", "[canonical_word]")
+{
+	const std::vector<CanonicalABWord> words{
+	  CanonicalABWord({{TARegionState{Location{"s0"}, "c0", 0}}}),
+	  CanonicalABWord({{TARegionState{Location{"s0"}, "c0", 1}}}),
+	  CanonicalABWord({{TARegionState{Location{"s1"}, "c0", 0}}}),
+	  CanonicalABWord(
+	    {{TARegionState{Location{"s0"}, "c0", 0}, TARegionState{Location{"s0"}, "c1", 1}}}),
+	  CanonicalABWord(
+	    {{TARegionState{Location{"s0"}, "c0", 0}, TARegionState{Location{"s0"}, "c1", 1}},
+	     {ATARegionState{logic::MTLFormula{AP{"a"}}, 0}}}),
+	  CanonicalABWord({{TARegionState{Location{"s0"}, "c0", 0}},
+	                   {ATARegionState{logic::MTLFormula{AP{"a"}}, 0}},
+	                   {ATARegionState{logic::MTLFormula{AP{"b"}}, 1}}}),
+	  CanonicalABWord({{ATARegionState{logic::MTLFormula{AP{"a"}}, 0},
+	                    ATARegionState{logic::MTLFormula{AP{"b"}}, 1},
+	                    TARegionState{Location{"s0"}, "c0", 0}}}),
+	  CanonicalABWord({{TARegionState{Location{"s0"}, "c1", 1}},
+	                   {TARegionState{Location{"s0"}, "c0", 0},
+	                    ATARegionState{logic::MTLFormula{AP{"a"}}, 0}}}),
+	};
+	search::SymbolCodes<automata::ta::Location<std::string>, std::string> codes;
+	for (const auto &w1 : words) {
+		for (const auto &w2 : words) {
+			CHECK(search::is_monotonically_dominated(codes.flatten(w1), codes.flatten(w2))
+			      == search::is_monotonically_dominated(w1, w2));
+			CHECK((codes.flatten(w1) == codes.flatten(w2)) == (w1 == w2));
+			const std::set<CanonicalABWord> set1{w1, words[0]};
+			const std::set<CanonicalABWord> set2{w2, words[3]};
+			CHECK(search::is_monotonically_dominated(codes.flatten(set1), codes.flatten(set2))
+			      == search::is_monotonically_dominated(set1, set2));
+		}
+	}
+	CHECK(codes.flatten(std::set<CanonicalABWord>{}).empty());
+	CHECK_THROWS_AS(codes.flatten(CanonicalABWord({{TARegionState{Location{"s0"}, "c0", 1u << 20}}})),
+	                std::invalid_argument);
+
+	// With an alphabet that is known in advance, the codes do not depend on the order of the lookups.
+	search::SymbolAlphabet<automata::ta::Location<std::string>, std::string> alphabet;
+	for (const auto &word : words) {
+		alphabet.insert(word);
+	}
+	search::SymbolCodes<automata::ta::Location<std::string>, std::string> codes1{alphabet};
+	search::SymbolCodes<automata::ta::Location<std::string>, std::string> codes2{alphabet};
+	codes1.flatten(words.back());
+	CHECK(codes1.flatten(words[5]) == codes2.flatten(words[5]));
+	// Symbols that are not in the alphabet still get a code.
+	const CanonicalABWord unknown_word({{TARegionState{Location{"s2"}, "c2", 0}}});
+	CHECK(codes1.flatten(unknown_word) == codes1.flatten(unknown_word));
+	CHECK(codes1.flatten(unknown_word) != codes1.flatten(words[0]));
+}
+
 TEST_CASE("Monotonic domination on nodes", "[canonical_word]")
 {
 	using Node =
@@ -353,6 +353,96 @@ TEST_CASE("Get enabled transitions", "[ta]")
 	      == std::vector<Transition>{{t1, t3, t5}});
 }
 
+TEST_CASE("Get transitions by source location and symbol", "[ta]")
+{
+	TimedAutomaton ta{{"a", "b"}, Location{"s0"}, {Location{"s1"}}};
+	ta.add_clock("x");
+	Transition t1{Location{"s0"}, "a", Location{"s1"}};
+	Transition t2{Location{"s0"}, "b", Location{"s0"}};
+	Transition t3{
+	  Location{"s0"}, "a", Location{"s0"}, {{"x", AtomicClockConstraintT<std::greater<Time>>(1)}}};
+	Transition t4{Location{"s1"}, "a", Location{"s1"}};
+	ta.add_transition(t1);
+	ta.add_transition(t2);
+	ta.add_transition(t3);
+	ta.add_transition(t4);
+	auto get_transitions = [](const TimedAutomaton &automaton,
+	                          const Location       &source,
+	                          const std::string    &symbol) {
+		std::vector<Transition> res;
+		for (const auto *transition : automaton.get_transitions(source, symbol)) {
+			res.push_back(*transition);
+		}
+		return res;
+	};
+	CHECK(get_transitions(ta, Location{"s0"}, "a") == std::vector<Transition>{{t1, t3}});
+	CHECK(get_transitions(ta, Location{"s0"}, "b") == std::vector<Transition>{{t2}});
+	CHECK(get_transitions(ta, Location{"s1"}, "a") == std::vector<Transition>{{t4}});
+	CHECK(ta.get_transitions(Location{"s1"}, "b").empty());
+	// The index only points to the TA's own transitions, also in a copy.
+	const TimedAutomaton copy{ta};
+	CHECK(get_transitions(copy, Location{"s0"}, "a") == std::vector<Transition>{{t1, t3}});
+	for (const auto *transition : copy.get_transitions(Location{"s0"}, "a")) {
+		CHECK(std::any_of(std::begin(copy.get_transitions()),
+		                  std::end(copy.get_transitions()),
+		                  [transition](const auto &entry) { return &entry.second == transition; }));
+	}
+	// The same holds if the automaton is assigned.
+	TimedAutomaton assigned{{"b"}, Location{"s1"}, {Location{"s1"}}};
+	assigned.add_transition(Transition{Location{"s1"}, "b", Location{"s1"}});
+	assigned = ta;
+	CHECK(get_transitions(assigned, Location{"s0"}, "a") == std::vector<Transition>{{t1, t3}});
+	CHECK(assigned.get_transitions(Location{"s1"}, "b").empty());
+	for (const auto *transition : assigned.get_transitions(Location{"s0"}, "a")) {
+		CHECK(std::any_of(std::begin(assigned.get_transitions()),
+		                  std::end(assigned.get_transitions()),
+		                  [transition](const auto &entry) { return &entry.second == transition; }));
+	}
+	TimedAutomaton moved{{"b"}, Location{"s1"}, {Location{"s1"}}};
+	moved = std::move(assigned);
+	CHECK(get_transitions(moved, Location{"s0"}, "a") == std::vector<Transition>{{t1, t3}});
+	CHECK(get_transitions(moved, Location{"s1"}, "a") == std::vector<Transition>{{t4}});
+	// Transitions with the same symbol are found even if other transitions are added in between.
+	CHECK(ta.make_symbol_step({Location{"s0"}, {{"x", 2}}}, "a")
+	      == std::set<Configuration>{{Location{"s1"}, {{"x", 2}}}, {Location{"s0"}, {{"x", 2}}}});
+}
+
+TEST_CASE("Acceptance distances of TA locations", "[ta]")
+{
+	TimedAutomaton ta{{"a", "b"}, Location{"s0"}, {Location{"s3"}}};
+	ta.add_locations({Location{"s1"}, Location{"s2"}, Location{"s4"}});
+	ta.add_clock("x");
+	ta.add_transition(Transition{
+	  Location{"s0"}, "a", Location{"s1"}, {{"x", AtomicClockConstraintT<std::greater<Time>>(1)}}});
+	ta.add_transition(Transition{Location{"s1"}, "a", Location{"s2"}});
+	ta.add_transition(Transition{Location{"s2"}, "b", Location{"s3"}});
+	ta.add_transition(Transition{Location{"s1"}, "b", Location{"s3"}});
+	ta.add_transition(Transition{Location{"s3"}, "a", Location{"s4"}});
+	CHECK(ta.get_acceptance_distances()
+	      == std::map<Location, std::size_t>{
+	        {Location{"s0"}, 2}, {Location{"s1"}, 1}, {Location{"s2"}, 1}, {Location{"s3"}, 0}});
+}
+
+TEST_CASE("Largest constants of TA clocks", "[ta]")
+{
+	TimedAutomaton ta{{"a", "b"}, Location{"s0"}, {Location{"s1"}}};
+	ta.add_location(Location{"s1"});
+	ta.add_clock("x");
+	ta.add_clock("y");
+	ta.add_clock("z");
+	ta.add_transition(Transition{Location{"s0"},
+	                             "a",
+	                             Location{"s1"},
+	                             {{"x", AtomicClockConstraintT<std::greater<Time>>(1)},
+	                              {"y", AtomicClockConstraintT<std::less_equal<Time>>(2)}}});
+	ta.add_transition(Transition{
+	  Location{"s1"}, "b", Location{"s0"}, {{"x", AtomicClockConstraintT<std::equal_to<Time>>(3)}}});
+	// z is never constrained, so its constant is 0.
+	CHECK(ta.get_largest_constants()
+	      == std::map<std::string, Endpoint>{{"x", 3}, {"y", 2}, {"z", 0}});
+	CHECK(ta.get_largest_constant() == 3);
+}
+
 TEST_CASE("Constructing invalid TAs throws exceptions", "[ta]")
 {
 	CHECK_THROWS(
@@ -316,6 +316,60 @@ TEST_CASE("The product of three timed automata", "[ta]")
 	CHECK(!product.accepts_word({{"1a", 0}, {"2a", 3}, {"3a", 4}}));
 }
 
+TEST_CASE("The product of timed automata restricted to reachable locations", "[ta]")
+{
+	TA ta1{{SingleLocation{"1l0"}, SingleLocation{"1l1"}, SingleLocation{"1l2"}},
+	       {"a"},
+	       SingleLocation{"1l0"},
+	       {SingleLocation{"1l1"}, SingleLocation{"1l2"}},
+	       {},
+	       {SingleTransition{SingleLocation{"1l0"}, "a", SingleLocation{"1l1"}},
+	        SingleTransition{SingleLocation{"1l2"}, "a", SingleLocation{"1l0"}}}};
+	TA ta2{{SingleLocation{"2l0"}, SingleLocation{"2l1"}},
+	       {"a"},
+	       SingleLocation{"2l0"},
+	       {SingleLocation{"2l1"}},
+	       {},
+	       {SingleTransition{SingleLocation{"2l0"}, "a", SingleLocation{"2l1"}},
+	        SingleTransition{SingleLocation{"2l1"}, "a", SingleLocation{"2l0"}}}};
+	const auto full_product = get_product<std::string, std::string>({ta1, ta2}, {"a"});
+	CHECK(full_product.get_locations().size() == 6);
+	CHECK(full_product.get_transitions().size() == 4);
+	const auto product = get_product<std::string, std::string>({ta1, ta2}, {"a"}, true);
+	CHECK(product.get_initial_location() == ProductLocation{{"1l0", "2l0"}});
+	CHECK(product.get_locations()
+	      == std::set{ProductLocation{{"1l0", "2l0"}}, ProductLocation{{"1l1", "2l1"}}});
+	CHECK(product.get_final_locations() == std::set{ProductLocation{{"1l1", "2l1"}}});
+	CHECK(product.get_transitions()
+	      == std::multimap<ProductLocation, ProductTransition>{
+	        {ProductLocation{{"1l0", "2l0"}},
+	         ProductTransition{ProductLocation{{"1l0", "2l0"}}, "a", ProductLocation{{"1l1", "2l1"}}}}});
+}
+
+TEST_CASE("The product does not depend on the number of threads", "[ta]")
+{
+	TA ta1{{"a", "b", "c"}, SingleLocation{"1l0"}, {SingleLocation{"1l1"}}};
+	TA ta2{{"a", "d", "e"}, SingleLocation{"2l0"}, {SingleLocation{"2l1"}}};
+	ta1.add_location(SingleLocation{"1l1"});
+	ta2.add_location(SingleLocation{"2l1"});
+	for (const auto &symbol : {"a", "b", "c"}) {
+		ta1.add_transition(SingleTransition{SingleLocation{"1l0"}, symbol, SingleLocation{"1l1"}});
+		ta1.add_transition(SingleTransition{SingleLocation{"1l1"}, symbol, SingleLocation{"1l0"}});
+	}
+	for (const auto &symbol : {"a", "d", "e"}) {
+		ta2.add_transition(SingleTransition{SingleLocation{"2l0"}, symbol, SingleLocation{"2l1"}});
+	}
+	const auto product          = get_product<std::string, std::string>({ta1, ta2}, {"a"}, false, 1);
+	const auto parallel_product = get_product<std::string, std::string>({ta1, ta2}, {"a"}, false, 4);
+	CHECK(product.get_locations() == parallel_product.get_locations());
+	CHECK(product.get_transitions() == parallel_product.get_transitions());
+	// All locations are reachable, so exploring the product results in the same automaton.
+	const auto reachable_product = get_product<std::string, std::string>({ta1, ta2}, {"a"}, true, 4);
+	CHECK(product.get_locations() == reachable_product.get_locations());
+	CHECK(product.get_final_locations() == reachable_product.get_final_locations());
+	CHECK(product.get_transitions() == reachable_product.get_transitions());
+}
+
 TEST_CASE("TA product error handling", "[ta]")
 {
 	SECTION("Cannot construct a product of two TAs with common clocks")
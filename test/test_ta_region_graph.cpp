@@ -0,0 +1,115 @@
+/***************************************************************************
+ *  test_ta_region_graph.cpp - Test the region graph of a TA
+ *
+ *  Created:   Fri 16 Oct 2026 12:35:06 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#include "automata/automata.h"
+#include "automata/ta.h"
+#include "automata/ta_region_graph.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+using namespace tacos;
+using namespace automata;
+using namespace automata::ta;
+using Location      = Location<std::string>;
+using Configuration = RegionalizedConfiguration<std::string>;
+
+TEST_CASE("Regionalize a TA configuration", "[taRegionGraph]")
+{
+	TAConfiguration<std::string> configuration{Location{"s0"}, {{"x", 0.5}, {"y", 1}, {"z", 3}}};
+	CHECK((get_regionalized_configuration(configuration, 2)
+	       == Configuration{Location{"s0"}, {{"x", 1}, {"y", 2}, {"z", 5}}}));
+}
+
+TEST_CASE("Region graph of a simple TA", "[taRegionGraph]")
+{
+	TimedAutomaton<std::string, std::string> ta{{"a", "b"}, Location{"s0"}, {Location{"s1"}}};
+	ta.add_location(Location{"s1"});
+	ta.add_clock("x");
+	ta.add_transition(Transition<std::string, std::string>(
+	  Location{"s0"}, "a", Location{"s1"}, {{"x", AtomicClockConstraintT<std::less<Time>>(1)}}, {"x"}));
+	ta.add_transition(Transition<std::string, std::string>(
+	  Location{"s1"}, "b", Location{"s0"}, {{"x", AtomicClockConstraintT<std::greater<Time>>(1)}}));
+
+	const RegionGraph<std::string, std::string> graph{ta, 1, 1};
+	CHECK(graph.get_max_constant() == 1);
+	CHECK(graph.size() == 8);
+	for (const auto &location : {"s0", "s1"}) {
+		for (RegionIndex region_index = 0; region_index <= 3; ++region_index) {
+			CHECK(graph.contains(Configuration{Location{location}, {{"x", region_index}}}));
+		}
+	}
+
+	const auto *enabled = graph.get_enabled_transitions(Configuration{Location{"s0"}, {{"x", 1}}});
+	REQUIRE(enabled != nullptr);
+	REQUIRE(enabled->size() == 1);
+	CHECK(enabled->at("a").size() == 1);
+	enabled = graph.get_enabled_transitions(Configuration{Location{"s0"}, {{"x", 2}}});
+	REQUIRE(enabled != nullptr);
+	CHECK(enabled->empty());
+	CHECK(graph.get_enabled_transitions(Configuration{Location{"s2"}, {{"x", 0}}}) == nullptr);
+
+	CHECK((graph.get_symbol_successors(Configuration{Location{"s0"}, {{"x", 1}}}, "a")
+	       == std::set{Configuration{Location{"s1"}, {{"x", 0}}}}));
+	CHECK(graph.get_symbol_successors(Configuration{Location{"s0"}, {{"x", 1}}}, "b").empty());
+	CHECK((graph.get_symbol_successors(Configuration{Location{"s1"}, {{"x", 3}}}, "b")
+	       == std::set{Configuration{Location{"s0"}, {{"x", 3}}}}));
+
+	SECTION("The graph does not depend on the number of threads")
+	{
+		const RegionGraph<std::string, std::string> parallel_graph{ta, 1, 4};
+		CHECK(parallel_graph.size() == graph.size());
+		for (const auto &location : {"s0", "s1"}) {
+			for (RegionIndex region_index = 0; region_index <= 3; ++region_index) {
+				const Configuration configuration{Location{location}, {{"x", region_index}}};
+				REQUIRE(parallel_graph.get_enabled_transitions(configuration) != nullptr);
+				CHECK(*parallel_graph.get_enabled_transitions(configuration)
+				      == *graph.get_enabled_transitions(configuration));
+			}
+		}
+	}
+}
+
+TEST_CASE("Time successors in the region graph", "[taRegionGraph]")
+{
+	TimedAutomaton<std::string, std::string> ta{{"a"}, Location{"s0"}, {}};
+	ta.add_clock("x");
+	ta.add_clock("y");
+	ta.add_transition(Transition<std::string, std::string>(
+	  Location{"s0"}, "a", Location{"s0"}, {{"x", AtomicClockConstraintT<std::less<Time>>(1)}}, {"x"}));
+	using Graph  = RegionGraph<std::string, std::string>;
+	using Region = Graph::Region;
+	const Graph graph{ta, 1};
+
+	// Clocks with integer valuation always move to the next region first and then have the smallest
+	// fractional part.
+	CHECK(graph.get_time_successor(Region{{Location{"s0"}, {{"x", 0}, {"y", 1}}}, {{"y"}}})
+	      == Region{{Location{"s0"}, {{"x", 1}, {"y", 1}}}, {{"x"}, {"y"}}});
+	// Without integer-valued clocks, the clocks with the largest fractional part reach the next
+	// integer first.
+	CHECK(graph.get_time_successor(Region{{Location{"s0"}, {{"x", 1}, {"y", 1}}}, {{"x"}, {"y"}}})
+	      == Region{{Location{"s0"}, {{"x", 1}, {"y", 2}}}, {{"x"}}});
+	CHECK(graph.get_time_successor(Region{{Location{"s0"}, {{"x", 1}, {"y", 1}}}, {{"y"}, {"x"}}})
+	      == Region{{Location{"s0"}, {{"x", 2}, {"y", 1}}}, {{"y"}}});
+	CHECK(graph.get_time_successor(Region{{Location{"s0"}, {{"x", 1}, {"y", 1}}}, {{"x", "y"}}})
+	      == Region{{Location{"s0"}, {{"x", 2}, {"y", 2}}}, {}});
+	// Clocks beyond the largest constant stay in their region.
+	CHECK(graph.get_time_successor(Region{{Location{"s0"}, {{"x", 3}, {"y", 1}}}, {{"y"}}})
+	      == Region{{Location{"s0"}, {{"x", 3}, {"y", 2}}}, {}});
+	CHECK(graph.get_time_successor(Region{{Location{"s0"}, {{"x", 2}, {"y", 3}}}, {}})
+	      == Region{{Location{"s0"}, {{"x", 3}, {"y", 3}}}, {}});
+	CHECK(!graph.get_time_successor(Region{{Location{"s0"}, {{"x", 3}, {"y", 3}}}, {}}));
+	// Both clocks start at 0 and x is only reset while it is below 1, so x can never be larger than
+	// y. The configurations where x is in a higher region than y are not reachable.
+	CHECK(graph.contains(Configuration{Location{"s0"}, {{"x", 1}, {"y", 2}}}));
+	CHECK(!graph.contains(Configuration{Location{"s0"}, {{"x", 2}, {"y", 1}}}));
+	CHECK(!graph.contains(Configuration{Location{"s0"}, {{"x", 3}, {"y", 2}}}));
+}
+
+} // namespace
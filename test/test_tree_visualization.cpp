@@ -44,7 +44,6 @@ create_test_graph()
 		  node->is_expanding = true;
 		  for (const auto &[action, child] : children) {
 			  node->add_child(action, child);
-			  child->parents = {node.get()};
 		  }
 		  return node;
 	  };
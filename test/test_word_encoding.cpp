@@ -0,0 +1,146 @@
+/***************************************************************************
+ *  test_word_encoding.cpp - Test the binary encoding of canonical words
+ *
+ *  Created:   Fri 16 Oct 2026 14:12:21 UTC
+ *  Copyright  2026  agent <agent@local>
+ *  SPDX-License-Identifier: LGPL-3.0-or-later
+ ****************************************************************************/
+
+#include "automata/ta.h"
+#include "mtl/MTLFormula.h"
+#include "search/canonical_word.h"
+#include "search/word_encoding.h"
+#include "utilities/varint.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using namespace tacos;
+
+using Location        = automata::ta::Location<std::string>;
+using CanonicalABWord = search::CanonicalABWord<Location, std::string>;
+using TARegionState   = search::PlantRegionState<Location>;
+using ATARegionState  = search::ATARegionState<std::string>;
+using AP              = logic::AtomicProposition<std::string>;
+using search::EncodedWordsView;
+using search::WordEncoder;
+using utilities::append_varint;
+using utilities::read_varint;
+
+TEST_CASE("Encode and decode varints", "[utilities]")
+{
+	std::string buffer;
+	for (std::uint64_t value : std::vector<std::uint64_t>{
+	       0, 1, 127, 128, 300, 16383, 16384, std::numeric_limits<std::uint64_t>::max()}) {
+		append_varint(value, buffer);
+	}
+	// Small values only need a single byte.
+	CHECK(buffer.size() == 1 + 1 + 1 + 2 + 2 + 2 + 3 + 10);
+	std::string_view view{buffer};
+	CHECK(read_varint(view) == 0);
+	CHECK(read_varint(view) == 1);
+	CHECK(read_varint(view) == 127);
+	CHECK(read_varint(view) == 128);
+	CHECK(read_varint(view) == 300);
+	CHECK(read_varint(view) == 16383);
+	CHECK(read_varint(view) == 16384);
+	CHECK(read_varint(view) == std::numeric_limits<std::uint64_t>::max());
+	CHECK(view.empty());
+	CHECK_THROWS_AS(read_varint(view), std::invalid_argument);
+	std::string_view truncated{"\x80"};
+	CHECK_THROWS_AS(read_varint(truncated), std::invalid_argument);
+}
+
+TEST_CASE("Encode and decode canonical words", "[search]")
+{
+	const logic::MTLFormula<std::string> a{AP{"a"}};
+	const logic::MTLFormula<std::string> b{AP{"b"}};
+	const CanonicalABWord                w1{{TARegionState{Location{"l0"}, "x", 0},
+                            TARegionState{Location{"l0"}, "y", 0}},
+                           {ATARegionState{a.until(b), 3}}};
+	const CanonicalABWord                w2{{TARegionState{Location{"l1"}, "x", 200}},
+                           {ATARegionState{a, 1}, TARegionState{Location{"l0"}, "y", 5}}};
+	WordEncoder<Location, std::string>   encoder;
+
+	SECTION("Single words")
+	{
+		const auto e1 = encoder.encode_word(w1);
+		const auto e2 = encoder.encode_word(w2);
+		CHECK(encoder.decode_word(e1) == w1);
+		CHECK(encoder.decode_word(e2) == w2);
+		// The encoding is deterministic.
+		CHECK(encoder.encode_word(w1) == e1);
+		CHECK(e1 != e2);
+		// Two components, the first with two plant states, the second with one ATA state.
+		CHECK(e1 == std::string{"\x02\x02\x00\x00\x00\x00\x00\x01\x01\x07\x00", 11});
+		CHECK(encoder.decode_word(encoder.encode_word(CanonicalABWord{})) == CanonicalABWord{});
+	}
+
+	SECTION("Sets of words")
+	{
+		const std::set<CanonicalABWord> words{w1, w2};
+		const auto                      encoding = encoder.encode_words(words);
+		CHECK(encoder.decode_words(encoding) == words);
+		const EncodedWordsView view{encoding};
+		CHECK(view.size() == 2);
+		std::set<CanonicalABWord> decoded;
+		for (const auto &word : view) {
+			// The view only points into the encoding.
+			CHECK(word.data() >= encoding.data());
+			CHECK(word.data() + word.size() <= encoding.data() + encoding.size());
+			decoded.insert(encoder.decode_word(word));
+		}
+		CHECK(decoded == words);
+		CHECK(encoder.decode_words(encoder.encode_words({})).empty());
+	}
+
+	SECTION("Encoders with the same alphabet produce the same encoding")
+	{
+		search::SymbolAlphabet<Location, std::string> alphabet;
+		alphabet.insert(w1);
+		alphabet.insert(w2);
+		WordEncoder<Location, std::string> encoder1{alphabet};
+		WordEncoder<Location, std::string> encoder2{alphabet};
+		// The indexes do not depend on the order in which the words are encoded.
+		const auto e2 = encoder1.encode_word(w2);
+		const auto e1 = encoder1.encode_word(w1);
+		CHECK(encoder2.encode_word(w1) == e1);
+		CHECK(encoder2.encode_word(w2) == e2);
+		CHECK(encoder2.decode_word(e2) == w2);
+		// l1 is the second location of the sorted alphabet, although it is encoded first.
+		CHECK(e2.substr(0, 6) == std::string{"\x02\x01\x90\x03\x01\x00", 6});
+		CHECK(encoder2.encode_words({w1, w2}) == encoder1.encode_words({w2, w1}));
+		// A symbol outside of the alphabet is still encoded.
+		const CanonicalABWord w3{{TARegionState{Location{"l2"}, "z", 0}}};
+		CHECK(encoder1.decode_word(encoder1.encode_word(w3)) == w3);
+	}
+
+	SECTION("Invalid encodings")
+	{
+		const auto encoding = encoder.encode_word(w1);
+		CHECK_THROWS_AS(encoder.decode_word(encoding.substr(0, encoding.size() - 1)),
+		                std::invalid_argument);
+		CHECK_THROWS_AS(encoder.decode_word(encoding + '\0'), std::invalid_argument);
+		// The symbols are unknown to a fresh encoder.
+		CHECK_THROWS_AS((WordEncoder<Location, std::string>{}.decode_word(encoding)),
+		                std::invalid_argument);
+		const auto words = encoder.encode_words({w1, w2});
+		CHECK_THROWS_AS(encoder.decode_words(words.substr(0, words.size() - 1)),
+		                std::invalid_argument);
+		// A corrupt number of components, symbols, or words is rejected before anything is allocated.
+		std::string huge_count;
+		append_varint(std::uint64_t{1} << 60, huge_count);
+		CHECK_THROWS_AS(encoder.decode_word(huge_count), std::invalid_argument);
+		CHECK_THROWS_AS(encoder.decode_word(std::string{"\x01"} + huge_count), std::invalid_argument);
+		CHECK_THROWS_AS(encoder.decode_words(huge_count), std::invalid_argument);
+	}
+}
+
+} // namespace